@@ -0,0 +1,193 @@
+// container/ring_queue/blocking_ring_queue.hh
+#pragma once
+
+#include "mpmc_ring_queue.hh"
+
+#include <atomic>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(__cpp_lib_atomic_wait)
+#error "BlockingRingQueue needs C++20 std::atomic::wait (build with -std=c++20)"
+#endif
+
+/**
+ * @file   blocking_ring_queue.hh
+ * @brief  Bounded MPMC queue whose push / pop block instead of spinning.
+ *
+ *  * Built on MpmcRingQueue: while the queue is neither empty nor full,
+ *    push / pop are its lock-free `try_push` / `try_pop` plus one fence
+ *    and one load of a "parked" flag – no syscall, no shared write.
+ *  * A thread that cannot make progress spins briefly, then parks on a
+ *    futex through `std::atomic::wait`. The other side issues a
+ *    `notify` only when that flag says someone is parked, and only
+ *    once per sleep.
+ *  * `close()` wakes everyone; pops drain what is left, then fail.
+ *  * Needs C++20 (`std::atomic::wait`); the rest of the family is C++17.
+ */
+template<class T>
+class BlockingRingQueue {
+  public:
+    /// Failed attempts before a thread parks.
+    static constexpr int kSpinLimit = 256;
+
+    /**
+     * @brief Constructs a queue holding at least @p cap elements.
+     *
+     * The capacity is rounded up to the next power-of-two, and to at least
+     * 2 (see MpmcRingQueue).
+     */
+    explicit BlockingRingQueue(std::size_t cap = 1024) : q_(cap) {}
+
+    BlockingRingQueue(const BlockingRingQueue&)            = delete;
+    BlockingRingQueue& operator=(const BlockingRingQueue&) = delete;
+
+    //==========================================================================//
+    //  Blocking API
+    //==========================================================================//
+
+    /**
+     * @brief Pushes @p val, waiting while the queue is full.
+     *
+     * @return `true` once pushed, `false` if the queue is (or gets) closed.
+     */
+    template<class U>
+    bool push(U&& val)
+    {
+        // try_push only consumes val when it succeeds, so retrying is safe.
+        return wait_until(not_full_, producer_parked_,
+                          [&] { return try_push(std::forward<U>(val)); });
+    }
+
+    /**
+     * @brief Pops the oldest element into @p out, waiting while empty.
+     *
+     * @return `true` on success, `false` once the queue is closed and empty.
+     */
+    bool pop(T& out)
+    {
+        return wait_until(not_empty_, consumer_parked_, [&] { return try_pop(out); });
+    }
+
+    //==========================================================================//
+    //  Non-blocking API (wakes parked threads as needed)
+    //==========================================================================//
+
+    /** @brief Pushes if there is room. @return `false` if full or closed. */
+    template<class U>
+    bool try_push(U&& val)
+    {
+        if (closed_.load(std::memory_order_relaxed)) return false;
+        if (!q_.try_push(std::forward<U>(val))) return false;
+        wake(not_empty_, consumer_parked_);
+        return true;
+    }
+
+    /** @brief Pops if not empty. @return `false` if empty. */
+    bool try_pop(T& out)
+    {
+        if (!q_.try_pop(out)) return false;
+        wake(not_full_, producer_parked_);
+        return true;
+    }
+
+    /**
+     * @brief Refuses further pushes and wakes every parked thread.
+     *
+     * Elements already queued can still be popped.
+     */
+    void close() noexcept
+    {
+        closed_.store(true, std::memory_order_seq_cst);
+        for (auto* word : { &not_empty_, &not_full_ }) {
+            word->fetch_add(1, std::memory_order_seq_cst);
+            word->notify_all();
+        }
+    }
+
+    //==========================================================================//
+    //  Queries (same caveats as MpmcRingQueue)
+    //==========================================================================//
+
+    [[nodiscard]] bool closed() const noexcept { return closed_.load(std::memory_order_acquire); }
+    [[nodiscard]] std::size_t size() const noexcept { return q_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return q_.empty(); }
+    [[nodiscard]] std::size_t capacity() const noexcept { return q_.capacity(); }
+
+private:
+    using Word = std::atomic<std::uint32_t>;
+    using Flag = std::atomic<bool>;
+
+    // ----------------------------------------------------------------- //
+    //  Parking protocol (one futex word + "someone is parked" flag per
+    //  direction):
+    //
+    //    waiter                          waker
+    //    seq = word                      make progress (push / pop)
+    //    parked = true                   fence
+    //    fence            ─ seq_cst ─    if (parked.exchange(false)) {
+    //    retry attempt()                     ++word; notify_all }
+    //    word.wait(seq)
+    //
+    //  Either the retry sees the waker's progress, or the waker sees the
+    //  flag and bumps the word, so wait(seq) cannot sleep through the
+    //  wakeup. The exchange hands each sleep to exactly one waker: pushes
+    //  made while the woken consumer is still being scheduled stay on the
+    //  fast path instead of each issuing a syscall.
+    //
+    //  A closed queue ends every wait after one last attempt: pops drain
+    //  what is left, pushes fail.
+    // ----------------------------------------------------------------- //
+    template<class Attempt>
+    bool wait_until(Word& word, Flag& parked, Attempt&& attempt)
+    {
+        for (int i = 0; i < kSpinLimit; ++i) {
+            if (attempt()) return true;
+            if (closed()) return attempt();
+            relax();
+        }
+        for (;;) {
+            const std::uint32_t seq = word.load(std::memory_order_acquire);
+            parked.store(true, std::memory_order_seq_cst);
+            // Pairs with the fence in wake(): attempt() only does acquire
+            // loads, which may otherwise be satisfied before the store.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (attempt()) return true;
+            if (closed()) return attempt();
+            word.wait(seq, std::memory_order_acquire);
+        }
+    }
+
+    static void wake(Word& word, Flag& parked) noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked.load(std::memory_order_relaxed) &&
+            parked.exchange(false, std::memory_order_acq_rel)) {
+            word.fetch_add(1, std::memory_order_release);
+            word.notify_all();
+        }
+    }
+
+    static void relax() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    MpmcRingQueue<T> q_;
+
+    alignas(ring_queue_detail::kCacheLine)
+    Word not_empty_{0};                    ///< Bumped to wake consumers
+    Flag consumer_parked_{false};          ///< A consumer is (about to be) asleep
+
+    alignas(ring_queue_detail::kCacheLine)
+    Word not_full_{0};                     ///< Bumped to wake producers
+    Flag producer_parked_{false};          ///< A producer is (about to be) asleep
+
+    alignas(ring_queue_detail::kCacheLine)
+    std::atomic<bool> closed_{false};
+};
@@ -0,0 +1,329 @@
+// container/ring_queue/broadcast_ring_queue.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <new>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+/**
+ * @file   broadcast_ring_queue.hh
+ * @brief  One producer, several consumers that each see *every* element
+ *         (disruptor-style broadcast) – one buffer instead of one queue
+ *         per consumer.
+ *
+ *  * Each consumer owns a cursor (a free-running position) into the same
+ *    power-of-two ring; an element is written once and retired when the
+ *    slowest cursor has passed it.
+ *  * Consumers read in batches: `segments(c)` returns the unread elements
+ *    as (at most) two contiguous spans, `consume(c, n)` moves the cursor.
+ *  * `BroadcastRingQueue<T>`: single thread, grows (like RingQueue) when
+ *    the slowest consumer lags by a full buffer.
+ *  * `SpmcBroadcastRingQueue<T>`: lock-free, one producer thread and one
+ *    thread per consumer; fixed capacity, the producer waits for the
+ *    slowest consumer instead of growing.
+ *  * C++17 (gem5 compatible).
+ */
+
+//==========================================================================//
+//  BroadcastRingQueue – single-threaded, growable
+//==========================================================================//
+
+template<class T>
+class BroadcastRingQueue {
+  public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    /**
+     * @brief Constructs a ring read by @p consumers consumers (ids
+     *        `0 .. consumers-1`), with room for @p init_cap elements.
+     */
+    explicit BroadcastRingQueue(std::size_t consumers, std::size_t init_cap = 16)
+        : cap_mask_(ring_queue_detail::reserve_power_of_two(init_cap) - 1)
+        , data_(std::allocator<T>().allocate(cap_mask_ + 1))
+        , cursors_(consumers, 0)
+    {
+        assert(consumers > 0 && "BroadcastRingQueue needs at least one consumer");
+        assert(init_cap > 0 && "initial capacity must be >0");
+    }
+
+    BroadcastRingQueue(const BroadcastRingQueue&)            = delete;
+    BroadcastRingQueue& operator=(const BroadcastRingQueue&) = delete;
+
+    ~BroadcastRingQueue()
+    {
+        retire_to(tail_);
+        std::allocator<T>().deallocate(data_, capacity());
+    }
+
+    //==========================================================================//
+    //  Producer API
+    //==========================================================================//
+
+    /** @brief Publishes @p val to every consumer; grows if the slowest lags by capacity(). */
+    template<class U>
+    void push(U&& val)
+    {
+        emplace(std::forward<U>(val));
+    }
+
+    /** @brief Constructs an element in-place at the back. */
+    template<class... Args>
+    T& emplace(Args&&... args)
+    {
+        if (tail_ - head_ == capacity()) grow_to(2 * capacity());
+        T* p = new (slot(tail_)) T(std::forward<Args>(args)...);
+        ++tail_;
+        return *p;
+    }
+
+    /**
+     * @brief Adds a consumer that sees elements pushed from now on.
+     *
+     * @return Its id.
+     */
+    std::size_t add_consumer()
+    {
+        cursors_.push_back(tail_);
+        return cursors_.size() - 1;
+    }
+
+    //==========================================================================//
+    //  Consumer API
+    //==========================================================================//
+
+    /** @brief Elements consumer @p c has not consumed yet. */
+    [[nodiscard]] std::size_t available(std::size_t c) const noexcept
+    {
+        assert(c < cursors_.size() && "unknown consumer");
+        return std::size_t(tail_ - cursors_[c]);
+    }
+
+    /** @brief Oldest element unread by @p c. @pre `available(c) > 0`. */
+    const T& front(std::size_t c) const
+    {
+        assert(available(c) > 0 && "front() with nothing available");
+        return *slot(cursors_[c]);
+    }
+
+    /** @brief The elements unread by @p c as (at most) two contiguous spans. */
+    std::pair<RingSpan<const T>, RingSpan<const T>> segments(std::size_t c) const noexcept
+    {
+        const std::size_t n = available(c);
+        const std::size_t start = std::size_t(cursors_[c]) & cap_mask_;
+        const std::size_t first_len = std::min(n, capacity() - start);
+        return { { data_ + start, first_len }, { data_, n - first_len } };
+    }
+
+    /**
+     * @brief Marks the @p n oldest unread elements of @p c as read.
+     *
+     * Elements every consumer has read are destroyed.
+     *
+     * @pre `n <= available(c)`.
+     */
+    void consume(std::size_t c, std::size_t n)
+    {
+        assert(n <= available(c) && "consume() beyond available()");
+        const bool was_slowest = cursors_[c] == head_;
+        cursors_[c] += n;
+        if (was_slowest) retire_to(*std::min_element(cursors_.begin(), cursors_.end()));
+    }
+
+    /** @brief `consume(c, 1)`. */
+    void pop(std::size_t c) { consume(c, 1); }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    /** @brief Elements retained: unread by at least one consumer. */
+    [[nodiscard]] std::size_t size() const noexcept { return std::size_t(tail_ - head_); }
+    [[nodiscard]] bool empty() const noexcept { return tail_ == head_; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return cap_mask_ + 1; }
+    [[nodiscard]] std::size_t consumers() const noexcept { return cursors_.size(); }
+
+private:
+    std::size_t cap_mask_;               ///< capacity()-1
+    T* data_;
+    std::uint64_t head_ = 0;             ///< Slowest cursor: oldest live element
+    std::uint64_t tail_ = 0;             ///< Next position to write
+    std::vector<std::uint64_t> cursors_; ///< Next position each consumer reads
+
+    T* slot(std::uint64_t pos) const noexcept { return data_ + (std::size_t(pos) & cap_mask_); }
+
+    void retire_to(std::uint64_t pos) noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (std::uint64_t p = head_; p != pos; ++p) slot(p)->~T();
+        }
+        head_ = pos;
+    }
+
+    // ----------------------------------------------------------------- //
+    //  Positions are absolute, so growing only re-homes each live element
+    //  from `pos & old_mask` to `pos & new_mask`; cursors stay valid.
+    // ----------------------------------------------------------------- //
+    void grow_to(std::size_t new_cap)
+    {
+        T* fresh = std::allocator<T>().allocate(new_cap);
+        const std::size_t new_mask = new_cap - 1;
+        std::uint64_t p = head_;
+        try {
+            for (; p != tail_; ++p)
+                new (fresh + (std::size_t(p) & new_mask)) T(std::move_if_noexcept(*slot(p)));
+        } catch (...) {
+            for (std::uint64_t q = head_; q != p; ++q) fresh[std::size_t(q) & new_mask].~T();
+            std::allocator<T>().deallocate(fresh, new_cap);
+            throw;
+        }
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (p = head_; p != tail_; ++p) slot(p)->~T();
+        }
+        std::allocator<T>().deallocate(data_, capacity());
+        data_ = fresh;
+        cap_mask_ = new_mask;
+    }
+};
+
+//==========================================================================//
+//  SpmcBroadcastRingQueue – lock-free, fixed capacity
+//==========================================================================//
+
+template<class T>
+class SpmcBroadcastRingQueue {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "SpmcBroadcastRingQueue overwrites slots in place: T must be trivially copyable");
+
+  public:
+    /**
+     * @brief Constructs a ring read by @p consumers consumer threads,
+     *        holding at least @p cap elements.
+     */
+    explicit SpmcBroadcastRingQueue(std::size_t consumers, std::size_t cap = 1024)
+        : cap_mask_(ring_queue_detail::reserve_power_of_two(cap) - 1)
+        , consumers_(consumers)
+        , cursors_(new Cursor[consumers])
+        , data_(std::allocator<T>().allocate(cap_mask_ + 1))
+    {
+        assert(consumers > 0 && "SpmcBroadcastRingQueue needs at least one consumer");
+        assert(cap > 0 && "capacity must be >0");
+    }
+
+    SpmcBroadcastRingQueue(const SpmcBroadcastRingQueue&)            = delete;
+    SpmcBroadcastRingQueue& operator=(const SpmcBroadcastRingQueue&) = delete;
+
+    // T is trivially destructible: nothing to destroy, only the storage.
+    ~SpmcBroadcastRingQueue() { std::allocator<T>().deallocate(data_, capacity()); }
+
+    //==========================================================================//
+    //  Producer API (one thread)
+    //==========================================================================//
+
+    /** @brief Publishes @p val if the slowest consumer leaves room. */
+    bool try_push(const T& val)
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - min_cache_ > cap_mask_) {
+            // Looks full – refresh our view of the slowest consumer.
+            min_cache_ = slowest();
+            if (tail - min_cache_ > cap_mask_) return false;
+        }
+        new (data_ + (tail & cap_mask_)) T(val);  // raw slot, or one all consumers passed
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** @brief Publishes @p val, spinning while the slowest consumer lags. */
+    void push(const T& val)
+    {
+        while (!try_push(val)) relax();
+    }
+
+    //==========================================================================//
+    //  Consumer API (thread of consumer c)
+    //==========================================================================//
+
+    /** @brief Elements published but not yet consumed by @p c. */
+    [[nodiscard]] std::size_t available(std::size_t c) const noexcept
+    {
+        assert(c < consumers_ && "unknown consumer");
+        return tail_.load(std::memory_order_acquire)
+             - cursors_[c].pos.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief The elements unread by @p c as (at most) two contiguous spans.
+     *
+     * They stay valid (the producer cannot overwrite them) until @p c
+     * consumes them.
+     */
+    std::pair<RingSpan<const T>, RingSpan<const T>> segments(std::size_t c) const noexcept
+    {
+        const std::size_t pos   = cursors_[c].pos.load(std::memory_order_relaxed);
+        const std::size_t n     = tail_.load(std::memory_order_acquire) - pos;
+        const std::size_t start = pos & cap_mask_;
+        const std::size_t first_len = std::min(n, cap_mask_ + 1 - start);
+        return { { data_ + start, first_len }, { data_, n - first_len } };
+    }
+
+    /** @brief Marks @p n elements read by @p c. @pre `n <= available(c)`. */
+    void consume(std::size_t c, std::size_t n) noexcept
+    {
+        assert(n <= available(c) && "consume() beyond available()");
+        auto& pos = cursors_[c].pos;
+        pos.store(pos.load(std::memory_order_relaxed) + n, std::memory_order_release);
+    }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return cap_mask_ + 1; }
+    [[nodiscard]] std::size_t consumers() const noexcept { return consumers_; }
+
+private:
+    struct alignas(ring_queue_detail::kCacheLine) Cursor {
+        std::atomic<std::size_t> pos{0};  ///< Next position this consumer reads
+    };
+
+    std::size_t slowest() const noexcept
+    {
+        std::size_t m = cursors_[0].pos.load(std::memory_order_acquire);
+        for (std::size_t c = 1; c < consumers_; ++c) {
+            const std::size_t p = cursors_[c].pos.load(std::memory_order_acquire);
+            if (std::ptrdiff_t(p - m) < 0) m = p;
+        }
+        return m;
+    }
+
+    static void relax() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    // Read-only after construction.
+    alignas(ring_queue_detail::kCacheLine)
+    const std::size_t cap_mask_;
+    const std::size_t consumers_;
+    const std::unique_ptr<Cursor[]> cursors_;   ///< One cache line each
+    T* const data_;                             ///< Raw storage, constructed on push
+
+    // Producer-owned line.
+    alignas(ring_queue_detail::kCacheLine)
+    std::atomic<std::size_t> tail_{0};          ///< Next position to write
+    std::size_t min_cache_ = 0;                 ///< Producer's copy of slowest()
+};
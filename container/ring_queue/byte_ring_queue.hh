@@ -0,0 +1,396 @@
+// container/ring_queue/byte_ring_queue.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <atomic>
+#include <memory>
+#include <cassert>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+/**
+ * @file   byte_ring_queue.hh
+ * @brief  Ring of variable-length byte records (packets, trace messages)
+ *         stored inline – no allocation per record.
+ *
+ *  * One power-of-two byte buffer, free-running byte positions masked on
+ *    access as in RingQueue. Each record is a 4-byte length header
+ *    followed by the payload, rounded up to 8 bytes, so records start
+ *    8-byte aligned and payloads 4-byte aligned.
+ *  * A record never straddles the wrap point: when it does not fit before
+ *    the end of the buffer, the producer writes a padding marker there and
+ *    starts the record at offset 0. Every payload is one contiguous span.
+ *  * Producer: `reserve(len)` returns room for up to @p len bytes, filled
+ *    in place, then `commit(n)` publishes the first n of them. Consumer:
+ *    `peek()` returns the oldest record, `release()` drops it.
+ *  * `ByteRingQueue`: single thread, grows (like RingQueue) when a record
+ *    does not fit.
+ *  * `SpscByteRingQueue`: lock-free, one producer thread and one consumer
+ *    thread; fixed capacity, `try_reserve` reports a full ring.
+ *  * C++17 (gem5 compatible).
+ */
+
+namespace ring_queue_detail {
+
+// ----------------------------------------------------------------- //
+//  Record layout shared by both byte rings
+// ----------------------------------------------------------------- //
+struct ByteRecord {
+    static constexpr std::size_t kHeader = sizeof(std::uint32_t);
+    static constexpr std::size_t kAlign  = 8;
+    /// Header value of the padding that skips to the end of the buffer.
+    static constexpr std::uint32_t kPad  = ~std::uint32_t(0);
+
+    /// Bytes a record with @p len payload bytes occupies in the ring.
+    static constexpr std::size_t bytes(std::size_t len) noexcept
+    {
+        return (kHeader + len + kAlign - 1) & ~(kAlign - 1);
+    }
+
+    static std::uint32_t header(const std::uint8_t* at) noexcept
+    {
+        std::uint32_t h;
+        std::memcpy(&h, at, kHeader);
+        return h;
+    }
+
+    static void set_header(std::uint8_t* at, std::uint32_t h) noexcept
+    {
+        std::memcpy(at, &h, kHeader);
+    }
+};
+
+} // namespace ring_queue_detail
+
+//==========================================================================//
+//  ByteRingQueue – single-threaded, growable
+//==========================================================================//
+
+class ByteRingQueue {
+    using Record = ring_queue_detail::ByteRecord;
+
+  public:
+    /** @brief Constructs an empty ring of at least @p init_bytes bytes. */
+    explicit ByteRingQueue(std::size_t init_bytes = 4096)
+        : cap_mask_(ring_queue_detail::reserve_power_of_two(std::max(init_bytes, 2 * Record::kAlign)) - 1)
+        , data_(new std::uint8_t[cap_mask_ + 1])
+    {
+        assert(init_bytes > 0 && "initial capacity must be >0");
+    }
+
+    ByteRingQueue(const ByteRingQueue&)            = delete;
+    ByteRingQueue& operator=(const ByteRingQueue&) = delete;
+
+    //==========================================================================//
+    //  Producer API
+    //==========================================================================//
+
+    /**
+     * @brief Reserves room for a record of up to @p len bytes at the back.
+     *
+     * May grow the ring, which invalidates spans returned by peek().
+     *
+     * @return Where to write the payload; valid until commit().
+     * @pre No reservation is pending.
+     */
+    std::uint8_t* reserve(std::size_t len)
+    {
+        assert(reserved_ == kNone && "reserve() while a reservation is pending");
+        assert(len < Record::kPad && "record too large");
+        const std::size_t need = Record::bytes(len);
+        std::size_t pad = pad_before(tail_, need);
+        if (bytes() + pad + need > capacity()) {
+            if (count_ == 0) head_ = tail_ = 0;     // nothing to keep: restart at 0
+            if (count_ != 0 || need > capacity())
+                grow_to(std::max(2 * capacity(), ring_queue_detail::next_power_of_two(bytes() + need)));
+            pad = 0;                                // the record now starts before the wrap
+        }
+        if (pad) Record::set_header(at(tail_), Record::kPad);
+        reserved_at_ = tail_ + pad;
+        reserved_ = len;
+        return at(reserved_at_) + Record::kHeader;
+    }
+
+    /**
+     * @brief Publishes the first @p n bytes written since reserve().
+     *
+     * @pre `n <= len` of the pending reservation.
+     */
+    void commit(std::size_t n)
+    {
+        assert(reserved_ != kNone && "commit() without reserve()");
+        assert(n <= reserved_ && "commit() beyond the reservation");
+        Record::set_header(at(reserved_at_), std::uint32_t(n));
+        tail_ = reserved_at_ + Record::bytes(n);
+        reserved_ = kNone;
+        ++count_;
+    }
+
+    /** @brief Publishes the whole pending reservation. */
+    void commit() { commit(reserved_); }
+
+    /** @brief Copies @p len bytes from @p src into a new record. */
+    void push(const void* src, std::size_t len)
+    {
+        std::uint8_t* dst = reserve(len);
+        if (len) std::memcpy(dst, src, len);
+        commit(len);
+    }
+
+    //==========================================================================//
+    //  Consumer API
+    //==========================================================================//
+
+    /**
+     * @brief Payload of the oldest record; valid until release() or the
+     *        next reserve().
+     *
+     * @pre `!empty()`.
+     */
+    RingSpan<const std::uint8_t> peek() const
+    {
+        assert(!empty() && "peek() on empty ring");
+        const std::uint8_t* rec = at(front_pos());
+        return { rec + Record::kHeader, Record::header(rec) };
+    }
+
+    /** @brief Drops the oldest record. @pre `!empty()`. */
+    void release()
+    {
+        assert(!empty() && "release() on empty ring");
+        const std::uint64_t pos = front_pos();
+        head_ = pos + Record::bytes(Record::header(at(pos)));
+        --count_;
+    }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    /** @brief Number of committed records. */
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+
+    /** @brief Ring bytes in use: headers, payloads, alignment and padding. */
+    [[nodiscard]] std::size_t bytes() const noexcept { return std::size_t(tail_ - head_); }
+
+    /** @brief Buffer size in bytes (always a power-of-two). */
+    [[nodiscard]] std::size_t capacity() const noexcept { return cap_mask_ + 1; }
+
+private:
+    static constexpr std::size_t kNone = ~std::size_t(0);
+
+    std::size_t cap_mask_;                 ///< capacity()-1
+    std::unique_ptr<std::uint8_t[]> data_;
+    std::uint64_t head_ = 0;               ///< Oldest record (or padding before it)
+    std::uint64_t tail_ = 0;               ///< Next free byte
+    std::size_t count_ = 0;                ///< Committed records
+    std::size_t reserved_ = kNone;         ///< Pending reservation length
+    std::uint64_t reserved_at_ = 0;        ///< Pending record position
+
+    std::uint8_t* at(std::uint64_t pos) const noexcept { return data_.get() + (std::size_t(pos) & cap_mask_); }
+
+    // Padding a record of `need` bytes at `pos` needs to avoid the wrap.
+    std::size_t pad_before(std::uint64_t pos, std::size_t need) const noexcept
+    {
+        const std::size_t room = capacity() - (std::size_t(pos) & cap_mask_);
+        return room < need ? room : 0;
+    }
+
+    // Position of the oldest record, skipping padding at the head.
+    std::uint64_t front_pos() const noexcept
+    {
+        const std::uint64_t pos = head_;
+        if (Record::header(at(pos)) != Record::kPad) return pos;
+        return pos + capacity() - (std::size_t(pos) & cap_mask_);
+    }
+
+    // ----------------------------------------------------------------- //
+    //  Copies the records, in order and without padding, to the start of
+    //  a buffer of new_cap bytes. Padding depends on where the wrap point
+    //  falls, so the layout is rebuilt rather than re-homed.
+    // ----------------------------------------------------------------- //
+    void grow_to(std::size_t new_cap)
+    {
+        std::unique_ptr<std::uint8_t[]> fresh(new std::uint8_t[new_cap]);
+        std::size_t w = 0;
+        std::uint64_t pos = head_;
+        for (std::size_t i = 0; i < count_; ++i) {
+            if (Record::header(at(pos)) == Record::kPad)
+                pos += capacity() - (std::size_t(pos) & cap_mask_);
+            const std::size_t n = Record::bytes(Record::header(at(pos)));
+            std::memcpy(fresh.get() + w, at(pos), n);
+            pos += n;
+            w += n;
+        }
+        data_ = std::move(fresh);
+        cap_mask_ = new_cap - 1;
+        head_ = 0;
+        tail_ = w;
+    }
+};
+
+//==========================================================================//
+//  SpscByteRingQueue – lock-free, fixed capacity
+//==========================================================================//
+
+class SpscByteRingQueue {
+    using Record = ring_queue_detail::ByteRecord;
+
+  public:
+    /**
+     * @brief Constructs an empty ring of at least @p cap bytes.
+     *
+     * Records may be up to max_record() bytes, about half the capacity:
+     * with padding at the wrap, that is what always fits in an empty ring.
+     */
+    explicit SpscByteRingQueue(std::size_t cap = 65536)
+        : cap_mask_(ring_queue_detail::reserve_power_of_two(std::max(cap, 2 * Record::kAlign)) - 1)
+        , data_(new std::uint8_t[cap_mask_ + 1])
+    {
+        assert(cap > 0 && "capacity must be >0");
+    }
+
+    SpscByteRingQueue(const SpscByteRingQueue&)            = delete;
+    SpscByteRingQueue& operator=(const SpscByteRingQueue&) = delete;
+
+    //==========================================================================//
+    //  Producer API
+    //==========================================================================//
+
+    /**
+     * @brief Reserves room for a record of up to @p len bytes.
+     *
+     * @return Where to write the payload, or `nullptr` if the ring is too
+     *         full (nothing is reserved then).
+     * @pre `len <= max_record()`; no reservation is pending.
+     * @note Producer thread only.
+     */
+    std::uint8_t* try_reserve(std::size_t len)
+    {
+        assert(len <= max_record() && "record larger than max_record()");
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        const std::size_t need = Record::bytes(len);
+        const std::size_t room = capacity() - (tail & cap_mask_);
+        const std::size_t pad = room < need ? room : 0;
+        if (tail + pad + need - head_cache_ > capacity()) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail + pad + need - head_cache_ > capacity()) return nullptr;
+        }
+        if (pad) Record::set_header(at(tail), Record::kPad);
+        reserved_at_ = tail + pad;
+        return at(reserved_at_) + Record::kHeader;
+    }
+
+    /**
+     * @brief Reserves room for @p len bytes, spinning while the ring is full.
+     *
+     * @note Producer thread only.
+     */
+    std::uint8_t* reserve(std::size_t len)
+    {
+        std::uint8_t* p;
+        while (!(p = try_reserve(len))) {}
+        return p;
+    }
+
+    /**
+     * @brief Publishes the first @p n bytes written since the last
+     *        successful reserve.
+     *
+     * @pre @p n is at most the reserved length.
+     * @note Producer thread only.
+     */
+    void commit(std::size_t n) noexcept
+    {
+        Record::set_header(at(reserved_at_), std::uint32_t(n));
+        tail_.store(reserved_at_ + Record::bytes(n), std::memory_order_release);
+    }
+
+    /** @brief Copies @p len bytes into a new record if there is room. */
+    bool try_push(const void* src, std::size_t len)
+    {
+        std::uint8_t* dst = try_reserve(len);
+        if (!dst) return false;
+        if (len) std::memcpy(dst, src, len);
+        commit(len);
+        return true;
+    }
+
+    //==========================================================================//
+    //  Consumer API
+    //==========================================================================//
+
+    /**
+     * @brief Payload of the oldest record; `data() == nullptr` if none has
+     *        been published. Valid until release().
+     *
+     * @note Consumer thread only.
+     */
+    RingSpan<const std::uint8_t> peek()
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_) return {};
+        }
+        const std::uint8_t* rec = at(front_pos(head));
+        return { rec + Record::kHeader, Record::header(rec) };
+    }
+
+    /**
+     * @brief Drops the oldest record.
+     *
+     * @pre `peek().data() != nullptr` (checked by the same consumer thread).
+     * @note Consumer thread only.
+     */
+    void release() noexcept
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        assert(head != tail_cache_ && "release() on empty ring");
+        const std::size_t pos = front_pos(head);
+        head_.store(pos + Record::bytes(Record::header(at(pos))), std::memory_order_release);
+    }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    /** @brief Buffer size in bytes (always a power-of-two). */
+    [[nodiscard]] std::size_t capacity() const noexcept { return cap_mask_ + 1; }
+
+    /** @brief Largest payload try_reserve() accepts. */
+    [[nodiscard]] std::size_t max_record() const noexcept
+    {
+        return capacity() / 2 - Record::kHeader;
+    }
+
+private:
+    std::uint8_t* at(std::size_t pos) const noexcept { return data_.get() + (pos & cap_mask_); }
+
+    std::size_t front_pos(std::size_t pos) const noexcept
+    {
+        if (Record::header(at(pos)) != Record::kPad) return pos;
+        return pos + capacity() - (pos & cap_mask_);
+    }
+
+    // Read-only after construction – shared freely by both sides.
+    alignas(ring_queue_detail::kCacheLine)
+    const std::size_t cap_mask_;                 ///< capacity()-1
+    const std::unique_ptr<std::uint8_t[]> data_;
+
+    // Consumer-owned line.
+    alignas(ring_queue_detail::kCacheLine)
+    std::atomic<std::size_t> head_{0};           ///< Oldest record (or padding before it)
+    std::size_t tail_cache_ = 0;                 ///< Consumer's copy of tail_
+
+    // Producer-owned line.
+    alignas(ring_queue_detail::kCacheLine)
+    std::atomic<std::size_t> tail_{0};           ///< Next free byte
+    std::size_t head_cache_ = 0;                 ///< Producer's copy of head_
+    std::size_t reserved_at_ = 0;                ///< Pending record position
+};
@@ -0,0 +1,441 @@
+// container/ring_queue/coro_channel.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <optional>
+#include <exception>
+#include <coroutine>
+#include <algorithm>
+#include <condition_variable>
+
+/**
+ * @file   coro_channel.hh
+ * @brief  Bounded channel for C++20 coroutines: `co_await ch.push(x)`,
+ *         `co_await ch.pop()`.
+ *
+ *  * The buffer is a RingQueue. A coroutine that finds it full (push) or
+ *    empty (pop) suspends and joins a waiter ring; the side that makes
+ *    room or data hands it over and *schedules* the waiter – it is never
+ *    resumed inline. The scheduler then resumes ready coroutines in
+ *    batches, so a producer fills the buffer, the consumer drains it,
+ *    and every switch moves up to `capacity()` elements.
+ *  * `CoroChannel<T>` + `CoroScheduler`: single thread, no locking.
+ *  * `MtCoroChannel<T>` + `MtCoroScheduler`: a mutex around the channel
+ *    state and a small worker pool that pops batches of ready handles.
+ *  * `close()` resumes every waiter; pops drain what is left, then
+ *    return `std::nullopt`; pushes return `false`.
+ *  * Needs C++20 (coroutines); the rest of the family is C++17.
+ */
+
+namespace ring_queue_detail {
+
+/// Lock policy for single-threaded channels.
+struct NullLock {
+    void lock() noexcept {}
+    void unlock() noexcept {}
+};
+
+} // namespace ring_queue_detail
+
+//==========================================================================//
+//  CoroTask – minimal fire-and-forget coroutine for the schedulers
+//==========================================================================//
+
+/**
+ * @brief Coroutine that starts suspended and frees itself when done.
+ *
+ * Hand it to a scheduler's `spawn()`; a task that is never spawned is
+ * destroyed with its CoroTask. An exception escaping the body terminates.
+ */
+class CoroTask {
+  public:
+    struct promise_type {
+        CoroTask get_return_object() noexcept
+        {
+            return CoroTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    CoroTask(CoroTask&& other) noexcept : h_(std::exchange(other.h_, {})) {}
+    CoroTask& operator=(CoroTask) = delete;
+    ~CoroTask() { if (h_) h_.destroy(); }
+
+    /// Gives up ownership; the coroutine now frees itself on completion.
+    std::coroutine_handle<> release() noexcept { return std::exchange(h_, {}); }
+
+  private:
+    explicit CoroTask(std::coroutine_handle<promise_type> h) noexcept : h_(h) {}
+
+    std::coroutine_handle<promise_type> h_;
+};
+
+//==========================================================================//
+//  CoroScheduler – single-threaded run queue
+//==========================================================================//
+
+class CoroScheduler {
+  public:
+    explicit CoroScheduler(std::size_t init_cap = 64) : ready_(init_cap) {}
+
+    /** @brief Queues @p task to start on the next run(). */
+    void spawn(CoroTask task) { schedule(task.release()); }
+
+    /** @brief Queues a suspended coroutine for resumption. */
+    void schedule(std::coroutine_handle<> h) { ready_.push(h); }
+
+    /**
+     * @brief Resumes ready coroutines until none is left.
+     *
+     * @return Number of resumptions.
+     */
+    std::size_t run()
+    {
+        std::size_t n = 0;
+        for (; !ready_.empty(); ++n) {
+            const std::coroutine_handle<> h = ready_.front();
+            ready_.pop();
+            h.resume();
+        }
+        return n;
+    }
+
+  private:
+    RingQueue<std::coroutine_handle<>> ready_;
+};
+
+//==========================================================================//
+//  MtCoroScheduler – worker pool over a shared run queue
+//==========================================================================//
+
+class MtCoroScheduler {
+  public:
+    /// Most handles a worker takes per lock acquisition.
+    static constexpr std::size_t kBatch = 64;
+
+    explicit MtCoroScheduler(std::size_t init_cap = 64) : ready_(init_cap) {}
+
+    MtCoroScheduler(const MtCoroScheduler&)            = delete;
+    MtCoroScheduler& operator=(const MtCoroScheduler&) = delete;
+
+    /** @brief Queues @p task to start on a worker. */
+    void spawn(CoroTask task) { schedule(task.release()); }
+
+    /** @brief Queues a suspended coroutine; wakes an idle worker if any. */
+    void schedule(std::coroutine_handle<> h)
+    {
+        std::unique_lock<std::mutex> lk(m_);
+        ready_.push(h);
+        if (idle_ == 0) return;
+        lk.unlock();
+        cv_.notify_one();
+    }
+
+    /**
+     * @brief Runs @p threads workers (the caller is one of them) until
+     *        the run queue is empty and every worker is idle.
+     *
+     * At that point nothing is left to schedule work: every task has
+     * finished or waits on a channel nobody will touch again.
+     *
+     * @return Number of resumptions.
+     */
+    std::size_t run(unsigned threads = std::max(1u, std::thread::hardware_concurrency()))
+    {
+        assert(threads > 0 && "run() needs at least one worker");
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            workers_  = threads;
+            idle_     = 0;
+            resumed_  = 0;
+            done_     = false;
+        }
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (unsigned i = 1; i < threads; ++i) pool.emplace_back([this] { work(); });
+        work();
+        for (auto& t : pool) t.join();
+        return resumed_;
+    }
+
+  private:
+    void work()
+    {
+        std::coroutine_handle<> batch[kBatch];
+        std::unique_lock<std::mutex> lk(m_);
+        while (!done_) {
+            if (ready_.empty()) {
+                if (++idle_ == workers_) {          // nobody left to schedule
+                    done_ = true;
+                    cv_.notify_all();
+                    break;
+                }
+                cv_.wait(lk, [this] { return done_ || !ready_.empty(); });
+                --idle_;
+                continue;
+            }
+            // Share the queue with the other workers, up to kBatch each.
+            const std::size_t n = std::min(kBatch, (ready_.size() + workers_ - 1) / workers_);
+            ready_.pop_n(batch, n);
+            resumed_ += n;
+            lk.unlock();
+            for (std::size_t i = 0; i < n; ++i) batch[i].resume();
+            lk.lock();
+        }
+    }
+
+    std::mutex m_;
+    std::condition_variable cv_;
+    RingQueue<std::coroutine_handle<>> ready_;
+    unsigned workers_ = 0;
+    unsigned idle_ = 0;                   ///< Workers blocked in cv_.wait
+    std::size_t resumed_ = 0;
+    bool done_ = false;
+};
+
+//==========================================================================//
+//  BasicCoroChannel
+//==========================================================================//
+
+/**
+ * @brief Bounded coroutine channel.
+ *
+ * @tparam Scheduler  Where woken waiters go: `schedule(coroutine_handle<>)`.
+ * @tparam Lock       Guards the channel state (`NullLock` for one thread).
+ *
+ * @pre The channel outlives every coroutine suspended on it.
+ */
+template<class T, class Scheduler, class Lock>
+class BasicCoroChannel {
+    struct Waiter {
+        std::coroutine_handle<> h;
+        std::optional<T> slot;           ///< Pusher: the value; popper: the result
+        bool ok = false;                 ///< Pusher: value was accepted
+    };
+
+  public:
+    class PushAwaiter : Waiter {
+      public:
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> h) { return ch_.suspend_push(*this, h); }
+        /// `false` if the channel was closed and the value dropped.
+        bool await_resume() const noexcept { return this->ok; }
+
+      private:
+        friend class BasicCoroChannel;
+        PushAwaiter(BasicCoroChannel& ch, T&& val) : ch_(ch) { this->slot.emplace(std::move(val)); }
+        BasicCoroChannel& ch_;
+    };
+
+    class PopAwaiter : Waiter {
+      public:
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> h) { return ch_.suspend_pop(*this, h); }
+        /// `std::nullopt` once the channel is closed and drained.
+        std::optional<T> await_resume() { return std::move(this->slot); }
+
+      private:
+        friend class BasicCoroChannel;
+        explicit PopAwaiter(BasicCoroChannel& ch) : ch_(ch) {}
+        BasicCoroChannel& ch_;
+    };
+
+    /**
+     * @brief Constructs a channel buffering at least @p cap elements.
+     *
+     * The capacity is rounded up to the next power-of-two.
+     */
+    explicit BasicCoroChannel(Scheduler& sched, std::size_t cap = 64)
+        : sched_(sched), buf_(cap), pushers_(4), poppers_(4)
+    {
+        assert(cap > 0 && "channel capacity must be >0");
+    }
+
+    BasicCoroChannel(const BasicCoroChannel&)            = delete;
+    BasicCoroChannel& operator=(const BasicCoroChannel&) = delete;
+
+    //==========================================================================//
+    //  Awaitable API
+    //==========================================================================//
+
+    /** @brief `co_await push(x)`: suspends while full. @return `false` if closed. */
+    [[nodiscard]] PushAwaiter push(T val) { return PushAwaiter(*this, std::move(val)); }
+
+    /** @brief `co_await pop()`: suspends while empty. */
+    [[nodiscard]] PopAwaiter pop() { return PopAwaiter(*this); }
+
+    //==========================================================================//
+    //  Non-suspending API (for code outside a coroutine)
+    //==========================================================================//
+
+    /**
+     * @brief Pushes if there is room.
+     *
+     * @p val is moved from only on success; a full or closed channel leaves
+     * it with the caller.
+     *
+     * @return `false` if full or closed.
+     */
+    bool try_push(T&& val)
+    {
+        Waiter w;
+        w.slot.emplace(std::move(val));
+        const std::coroutine_handle<> wake = [&] {
+            std::lock_guard<Lock> lk(lock_);
+            return offer(w) ? handoff_to_popper(w) : std::coroutine_handle<>();
+        }();
+        if (wake) sched_.schedule(wake);
+        if (!w.ok) val = std::move(*w.slot);          // refused: hand it back
+        return w.ok;
+    }
+
+    /** @brief Pushes a copy of @p val if there is room. @return `false` if full or closed. */
+    bool try_push(const T& val)
+    {
+        T copy(val);
+        return try_push(std::move(copy));
+    }
+
+    /** @brief Pops if not empty. */
+    std::optional<T> try_pop()
+    {
+        Waiter w;
+        const std::coroutine_handle<> wake = [&] {
+            std::lock_guard<Lock> lk(lock_);
+            return take(w);
+        }();
+        if (wake) sched_.schedule(wake);
+        return std::move(w.slot);
+    }
+
+    /**
+     * @brief Refuses further pushes and resumes every waiter.
+     *
+     * Buffered elements can still be popped.
+     */
+    void close()
+    {
+        RingQueue<Waiter*> woken;
+        {
+            std::lock_guard<Lock> lk(lock_);
+            closed_ = true;
+            std::swap(woken, pushers_);
+            while (!poppers_.empty()) {
+                woken.push(poppers_.front());
+                poppers_.pop();
+            }
+        }
+        for (Waiter* w : woken) sched_.schedule(w->h);
+    }
+
+    //==========================================================================//
+    //  Queries (a snapshot when shared between threads)
+    //==========================================================================//
+
+    [[nodiscard]] bool closed() const { std::lock_guard<Lock> lk(lock_); return closed_; }
+    [[nodiscard]] std::size_t size() const { std::lock_guard<Lock> lk(lock_); return buf_.size(); }
+    [[nodiscard]] std::size_t capacity() const noexcept { return buf_.capacity(); }
+
+private:
+    // ----------------------------------------------------------------- //
+    //  Invariants (under lock_): pushers_ waits only on a full buffer,
+    //  poppers_ only on an empty one, so at most one ring is non-empty.
+    //  A waiter's handle is scheduled after lock_ is released, and the
+    //  suspending side never touches its awaiter once it is enqueued.
+    // ----------------------------------------------------------------- //
+    bool suspend_push(Waiter& w, std::coroutine_handle<> h)
+    {
+        std::coroutine_handle<> wake;
+        {
+            std::lock_guard<Lock> lk(lock_);
+            if (!offer(w)) {
+                if (closed_) return false;
+                w.h = h;
+                pushers_.push(&w);
+                return true;
+            }
+            wake = handoff_to_popper(w);
+        }
+        if (wake) sched_.schedule(wake);
+        return false;
+    }
+
+    bool suspend_pop(Waiter& w, std::coroutine_handle<> h)
+    {
+        std::coroutine_handle<> wake;
+        {
+            std::lock_guard<Lock> lk(lock_);
+            if (buf_.empty() && !closed_) {
+                w.h = h;
+                poppers_.push(&w);
+                return true;
+            }
+            wake = take(w);
+        }
+        if (wake) sched_.schedule(wake);
+        return false;
+    }
+
+    // Can w's value go somewhere right now (a waiting popper or the buffer)?
+    bool offer(Waiter& w)
+    {
+        if (closed_) return false;
+        if (!poppers_.empty()) return true;
+        if (buf_.size() == buf_.capacity()) return false;
+        buf_.push(std::move(*w.slot));
+        w.ok = true;
+        return true;
+    }
+
+    // After a successful offer(): pass the value to the oldest popper, if
+    // it did not already go into the buffer. Returns the popper to wake.
+    std::coroutine_handle<> handoff_to_popper(Waiter& w)
+    {
+        if (w.ok) return {};
+        Waiter* p = poppers_.front();
+        poppers_.pop();
+        p->slot.emplace(std::move(*w.slot));
+        w.ok = true;
+        return p->h;
+    }
+
+    // Pops the oldest element into w.slot (none if empty) and refills
+    // the freed slot from the oldest pusher. Returns the pusher to wake.
+    std::coroutine_handle<> take(Waiter& w)
+    {
+        if (buf_.empty()) return {};
+        w.slot.emplace(std::move(buf_.front()));
+        buf_.pop();
+        if (pushers_.empty()) return {};
+        Waiter* p = pushers_.front();
+        pushers_.pop();
+        buf_.push(std::move(*p->slot));
+        p->ok = true;
+        return p->h;
+    }
+
+    Scheduler& sched_;
+    mutable Lock lock_;
+    RingQueue<T> buf_;
+    RingQueue<Waiter*> pushers_;         ///< Suspended on a full buffer
+    RingQueue<Waiter*> poppers_;         ///< Suspended on an empty buffer
+    bool closed_ = false;
+};
+
+/// Single-threaded channel: every coroutine runs on one CoroScheduler.
+template<class T>
+using CoroChannel = BasicCoroChannel<T, CoroScheduler, ring_queue_detail::NullLock>;
+
+/// Channel shared by the workers of an MtCoroScheduler.
+template<class T>
+using MtCoroChannel = BasicCoroChannel<T, MtCoroScheduler, std::mutex>;
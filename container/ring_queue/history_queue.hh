@@ -0,0 +1,225 @@
+// container/ring_queue/history_queue.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <memory>
+#include <cassert>
+#include <ostream>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+/**
+ * @file   history_queue.hh
+ * @brief  Bounded "last N events" ring: push on a full queue overwrites the
+ *         oldest element and never grows.
+ *
+ *  * Power-of-two capacity → wrap-around is a cheap `& (cap-1)`.
+ *  * Every slot holds a live (value-initialised) `T` from construction on,
+ *    so push() is a plain assignment: no full() branch, no destructor call.
+ *  * `dump()` streams the contents oldest → newest.
+ *  * C++17 (gem5 compatible).
+ */
+template<class T>
+class HistoryQueue {
+    static_assert(std::is_default_constructible_v<T>,
+                  "HistoryQueue pre-constructs its slots");
+
+  public:
+    using value_type     = T;
+    using size_type      = std::size_t;
+    using iterator       = ring_queue_detail::RingIterator<T>;
+    using const_iterator = ring_queue_detail::RingIterator<const T>;
+
+    //==========================================================================//
+    //  Construction
+    //==========================================================================//
+
+    /**
+     * @brief Constructs a history buffer keeping the last @p cap pushes.
+     *
+     * @p cap is rounded up to the next power-of-two.
+     *
+     * @post `capacity()` is a power-of-two and `size() == 0`.
+     */
+    explicit HistoryQueue(std::size_t cap = 1024)
+        : data_(std::make_unique<T[]>(ring_queue_detail::reserve_power_of_two(cap)))
+        , cap_mask_(ring_queue_detail::reserve_power_of_two(cap) - 1)
+    {
+        assert(cap > 0 && "capacity must be >0");
+    }
+
+    HistoryQueue(const HistoryQueue& other)
+        : data_(std::make_unique<T[]>(other.capacity()))
+        , tail_(other.tail_)
+        , count_(other.count_)
+        , cap_mask_(other.cap_mask_)
+    {
+        if (other.data_) std::copy(other.data_.get(), other.data_.get() + capacity(), data_.get());
+    }
+
+    /**
+     * @brief Move constructor – steals the slots.
+     *
+     * @post @p other is empty and has no slots: it may only be assigned
+     *       to, copied or destroyed (push() stays branch-free).
+     */
+    HistoryQueue(HistoryQueue&& other) noexcept
+        : data_(std::move(other.data_))
+        , tail_(std::exchange(other.tail_, 0))
+        , count_(std::exchange(other.count_, 0))
+        , cap_mask_(other.cap_mask_)
+    {}
+
+    /**
+     * @brief Move assignment – swaps the slots.
+     *
+     * @post @p other is empty and keeps this queue's former slots, so it
+     *       stays fully usable.
+     */
+    HistoryQueue& operator=(HistoryQueue&& other) noexcept
+    {
+        if (this != &other) {
+            data_.swap(other.data_);
+            std::swap(cap_mask_, other.cap_mask_);
+            tail_  = std::exchange(other.tail_, 0);
+            count_ = std::exchange(other.count_, 0);
+        }
+        return *this;
+    }
+
+    HistoryQueue& operator=(const HistoryQueue& other)
+    {
+        if (this != &other) *this = HistoryQueue(other);
+        return *this;
+    }
+
+    //==========================================================================//
+    //  Core API
+    //==========================================================================//
+
+    /**
+     * @brief Records a value, overwriting the oldest one when full.
+     *
+     * The slot is assigned, not constructed: the evicted element is simply
+     * replaced, and the size update is branch-free.
+     */
+    template<class U>
+    void push(U&& val)
+    {
+        data_[tail_] = std::forward<U>(val);
+        tail_ = (tail_ + 1) & cap_mask_;
+        count_ += count_ <= cap_mask_;
+    }
+
+    /**
+     * @brief Constructs a temporary from @p args and records it.
+     *
+     * @return Reference to the stored element.
+     */
+    template<class... Args>
+    T& emplace(Args&&... args)
+    {
+        T& slot = data_[tail_];
+        slot = T(std::forward<Args>(args)...);
+        tail_ = (tail_ + 1) & cap_mask_;
+        count_ += count_ <= cap_mask_;
+        return slot;
+    }
+
+    /** @brief Oldest retained element. @pre `!empty()`. */
+    T& front()
+    {
+        assert(!empty() && "front() on empty queue");
+        return data_[head()];
+    }
+    const T& front() const
+    {
+        assert(!empty() && "front() on empty queue");
+        return data_[head()];
+    }
+
+    /** @brief Most recent element. @pre `!empty()`. */
+    T& back()
+    {
+        assert(!empty() && "back() on empty queue");
+        return data_[(tail_ - 1) & cap_mask_];
+    }
+    const T& back() const
+    {
+        assert(!empty() && "back() on empty queue");
+        return data_[(tail_ - 1) & cap_mask_];
+    }
+
+    /** @brief i-th retained element, oldest first. @pre `i < size()`. */
+    T& operator[](std::size_t i)
+    {
+        assert(i < count_ && "operator[] out of range");
+        return data_[(head() + i) & cap_mask_];
+    }
+    const T& operator[](std::size_t i) const
+    {
+        assert(i < count_ && "operator[] out of range");
+        return data_[(head() + i) & cap_mask_];
+    }
+
+    /**
+     * @brief Forgets all entries. Slots keep their (stale) objects.
+     *
+     * @post `empty()`.
+     */
+    void clear() noexcept { tail_ = count_ = 0; }
+
+    //==========================================================================//
+    //  Iteration / dump
+    //==========================================================================//
+
+    iterator begin() noexcept { return { data_.get(), cap_mask_, tail_ - count_ }; }
+    iterator end() noexcept { return { data_.get(), cap_mask_, tail_ }; }
+    const_iterator begin() const noexcept { return { data_.get(), cap_mask_, tail_ - count_ }; }
+    const_iterator end() const noexcept { return { data_.get(), cap_mask_, tail_ }; }
+
+    /** @brief Contents as (at most) two contiguous spans, oldest first. */
+    std::pair<RingSpan<const T>, RingSpan<const T>> segments() const noexcept
+    {
+        const std::size_t h = head();
+        const std::size_t first_len = std::min(count_, capacity() - h);
+        return { { data_.get() + h, first_len }, { data_.get(), count_ - first_len } };
+    }
+
+    /**
+     * @brief Streams the retained entries, oldest → newest.
+     *
+     * Each element is written with `operator<<` followed by @p sep. The
+     * buffer is walked as its two contiguous runs – nothing is copied or
+     * popped, so the history stays intact.
+     *
+     * @return @p os for chaining.
+     */
+    std::ostream& dump(std::ostream& os, const char* sep = "\n") const
+    {
+        const auto [a, b] = segments();
+        for (const T& v : a) os << v << sep;
+        for (const T& v : b) os << v << sep;
+        return os;
+    }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] bool full() const noexcept { return count_ == capacity(); }
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return cap_mask_ + 1; }
+
+private:
+    std::unique_ptr<T[]> data_;      ///< All slots constructed up front
+    std::size_t tail_ = 0;           ///< Slot the next push overwrites
+    std::size_t count_ = 0;          ///< Retained elements (<= capacity)
+    std::size_t cap_mask_ = 0;       ///< capacity()-1, used for fast wrap
+
+    std::size_t head() const noexcept { return (tail_ - count_) & cap_mask_; }
+};
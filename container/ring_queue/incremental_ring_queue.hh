@@ -0,0 +1,303 @@
+// container/ring_queue/incremental_ring_queue.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <memory>
+#include <cassert>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+/**
+ * @file   incremental_ring_queue.hh
+ * @brief  Growing ring queue with de-amortised (incremental) growth.
+ *
+ *  * Same power-of-two layout and API core as RingQueue.
+ *  * When full, a buffer of twice the size is allocated but the live
+ *    elements are *not* moved in one go: the old buffer is kept, and every
+ *    following push / pop migrates at most `kMigrateStep` elements. No
+ *    single operation pays for moving the whole queue.
+ *  * Reads (`front`, `back`, `operator[]`) see the logical order at all
+ *    times, whichever buffer an element currently lives in.
+ *  * C++17 (gem5 compatible).
+ */
+template<class T>
+class IncrementalRingQueue {
+  public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    /// Elements migrated from the old buffer per push / pop.
+    static constexpr std::size_t kMigrateStep = 4;
+
+    //==========================================================================//
+    //  Construction
+    //==========================================================================//
+
+    /**
+     * @brief Constructs a queue with at least @p init_cap slots.
+     *
+     * @post `capacity()` is a power-of-two and `size() == 0`.
+     */
+    explicit IncrementalRingQueue(std::size_t init_cap = 16)
+        : cap_mask_(ring_queue_detail::reserve_power_of_two(init_cap) - 1)
+    {
+        assert(init_cap > 0 && "initial capacity must be >0");
+        data_ = allocate(capacity());
+    }
+
+    /** @brief Copies @p other's elements into a single, compact buffer. */
+    IncrementalRingQueue(const IncrementalRingQueue& other)
+        : IncrementalRingQueue(std::max<std::size_t>(other.capacity(), 1)) // moved-from: 0
+    {
+        for (std::size_t i = 0; i < other.count_; ++i) push(other[i]);
+    }
+
+    IncrementalRingQueue(IncrementalRingQueue&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr))
+        , head_(std::exchange(other.head_, 0))
+        , count_(std::exchange(other.count_, 0))
+        , cap_mask_(std::exchange(other.cap_mask_, kNoStorage))
+        , old_data_(std::exchange(other.old_data_, nullptr))
+        , old_head_(std::exchange(other.old_head_, 0))
+        , old_mask_(std::exchange(other.old_mask_, 0))
+        , pending_(std::exchange(other.pending_, 0))
+    {}
+
+    /** @brief Copy/move assignment (copy-and-swap). */
+    IncrementalRingQueue& operator=(IncrementalRingQueue other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~IncrementalRingQueue()
+    {
+        clear();
+        deallocate(data_, capacity());
+    }
+
+    void swap(IncrementalRingQueue& other) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(head_, other.head_);
+        std::swap(count_, other.count_);
+        std::swap(cap_mask_, other.cap_mask_);
+        std::swap(old_data_, other.old_data_);
+        std::swap(old_head_, other.old_head_);
+        std::swap(old_mask_, other.old_mask_);
+        std::swap(pending_, other.pending_);
+    }
+
+    //==========================================================================//
+    //  Core API
+    //==========================================================================//
+
+    /**
+     * @brief Pushes a value to the back of the queue.
+     *
+     * A full queue starts a new growth, which only allocates. The element
+     * is constructed before any migration step runs, so @p val may refer
+     * to an element of this queue.
+     *
+     * @note Strong exception guarantee when `T` is nothrow-move-constructible.
+     *       Otherwise a throwing migration copy propagates after the element
+     *       was pushed; the queue stays consistent.
+     */
+    template<class U>
+    void push(U&& val)
+    {
+        emplace(std::forward<U>(val));
+    }
+
+    /** @brief Constructs an element in-place at the back. */
+    template<class... Args>
+    T& emplace(Args&&... args)
+    {
+        if (full()) start_growth();
+        T* p = new (data_ + ((head_ + count_) & cap_mask_)) T(std::forward<Args>(args)...);
+        ++count_;
+        if (pending_) migrate(kMigrateStep);
+        return *p;
+    }
+
+    /** @brief Oldest element. @pre `!empty()`. */
+    T& front()
+    {
+        assert(!empty() && "front() on empty queue");
+        return (*this)[0];
+    }
+    const T& front() const
+    {
+        assert(!empty() && "front() on empty queue");
+        return (*this)[0];
+    }
+
+    /** @brief Youngest element. @pre `!empty()`. */
+    T& back()
+    {
+        assert(!empty() && "back() on empty queue");
+        return (*this)[count_ - 1];
+    }
+    const T& back() const
+    {
+        assert(!empty() && "back() on empty queue");
+        return (*this)[count_ - 1];
+    }
+
+    /**
+     * @brief i-th element from the front. @pre `i < size()`.
+     *
+     * The first `pending_` elements still live in the old buffer.
+     */
+    T& operator[](std::size_t i)
+    {
+        assert(i < count_ && "operator[] out of range");
+        return i < pending_ ? old_data_[(old_head_ + i) & old_mask_]
+                            : data_[(head_ + i) & cap_mask_];
+    }
+    const T& operator[](std::size_t i) const
+    {
+        assert(i < count_ && "operator[] out of range");
+        return i < pending_ ? old_data_[(old_head_ + i) & old_mask_]
+                            : data_[(head_ + i) & cap_mask_];
+    }
+
+    /**
+     * @brief Removes the front element.
+     *
+     * @pre `!empty()`.
+     */
+    void pop()
+    {
+        assert(!empty() && "pop() on empty queue");
+        if (pending_) {
+            // The front is still in the old buffer; its reserved slot in the
+            // new buffer is simply skipped.
+            old_data_[old_head_].~T();
+            old_head_ = (old_head_ + 1) & old_mask_;
+            --pending_;
+            head_ = (head_ + 1) & cap_mask_;
+            --count_;
+            if (pending_) migrate(kMigrateStep);
+            else release_old();
+            return;
+        }
+        data_[head_].~T();
+        head_ = (head_ + 1) & cap_mask_;
+        --count_;
+    }
+
+    /** @brief Destroys all elements. @post `empty()`. */
+    void clear() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (std::size_t i = 0; i < count_; ++i) (*this)[i].~T();
+        }
+        release_old();
+        head_ = count_ = 0;
+    }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] bool full() const noexcept { return count_ == capacity(); }
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return cap_mask_ + 1; }
+
+    /** @brief `true` while elements are still being moved to the new buffer. */
+    [[nodiscard]] bool migrating() const noexcept { return pending_ != 0; }
+
+    /**
+     * @brief Ensures `capacity() >= n`.
+     *
+     * This is an explicit request, so any migration – including the one for
+     * the new buffer – is completed immediately.
+     */
+    void reserve(std::size_t n)
+    {
+        if (n <= capacity()) return;
+        finish_migration();
+        start_growth(ring_queue_detail::next_power_of_two(n));
+        finish_migration();
+    }
+
+private:
+    /// cap_mask_ value for "no buffer": capacity() wraps around to 0.
+    static constexpr std::size_t kNoStorage = ~std::size_t(0);
+
+    T* data_ = nullptr;              ///< Current buffer; receives all pushes
+    std::size_t head_ = 0;           ///< Slot of logical element 0 in data_
+    std::size_t count_ = 0;          ///< Live element count (both buffers)
+    std::size_t cap_mask_ = kNoStorage; ///< capacity()-1
+
+    // Previous buffer during a migration. It holds the `pending_` oldest
+    // elements; their slots in data_ are [head_, head_ + pending_) and are
+    // filled back to front, so pops and migration never meet.
+    T* old_data_ = nullptr;          ///< Old buffer (nullptr when idle)
+    std::size_t old_head_ = 0;       ///< Slot of logical element 0 in old_data_
+    std::size_t old_mask_ = 0;       ///< Old capacity - 1
+    std::size_t pending_ = 0;        ///< Elements not yet migrated
+
+    static T* allocate(std::size_t n)
+    {
+        return std::allocator<T>().allocate(n);
+    }
+
+    static void deallocate(T* p, std::size_t n) noexcept
+    {
+        if (p) std::allocator<T>().deallocate(p, n);
+    }
+
+    // ----------------------------------------------------------------- //
+    //  Swap in a buffer of new_cap slots; the live elements stay put.
+    // ----------------------------------------------------------------- //
+    void start_growth(std::size_t new_cap = 0)
+    {
+        if (pending_) finish_migration();
+        if (new_cap == 0) new_cap = capacity() ? capacity() * 2 : 1;
+
+        T* new_data = allocate(new_cap);
+        if (count_ == 0) {
+            deallocate(data_, capacity());
+        } else {
+            old_data_ = data_;
+            old_head_ = head_;
+            old_mask_ = cap_mask_;
+            pending_  = count_;
+        }
+        data_     = new_data;
+        head_     = 0;
+        cap_mask_ = new_cap - 1;
+    }
+
+    // ----------------------------------------------------------------- //
+    //  Move up to n of the youngest pending elements into their slots.
+    //  A throwing copy leaves that element in the old buffer, so the
+    //  queue stays consistent.
+    // ----------------------------------------------------------------- //
+    void migrate(std::size_t n)
+    {
+        for (n = std::min(n, pending_); n > 0; --n) {
+            const std::size_t i = pending_ - 1;
+            T& src = old_data_[(old_head_ + i) & old_mask_];
+            new (data_ + ((head_ + i) & cap_mask_)) T(std::move_if_noexcept(src));
+            src.~T();
+            pending_ = i;
+        }
+        if (!pending_) release_old();
+    }
+
+    void finish_migration() { migrate(pending_); }
+
+    void release_old() noexcept
+    {
+        deallocate(old_data_, old_mask_ + 1);
+        old_data_ = nullptr;
+        old_head_ = old_mask_ = pending_ = 0;
+    }
+};
@@ -0,0 +1,299 @@
+// container/ring_queue/mirrored_ring_queue.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#if !defined(__linux__)
+#error "MirroredRingQueue needs Linux (memfd_create + mmap)"
+#endif
+
+#include <cerrno>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <initializer_list>
+#include <algorithm>
+#include <type_traits>
+#include <system_error>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+/**
+ * @file   mirrored_ring_queue.hh
+ * @brief  Ring queue whose buffer is mapped twice, back to back (Linux).
+ *
+ *  * One memfd-backed buffer of `capacity()` elements is mapped at
+ *    `base` and again at `base + capacity()`. Slot `i` and slot
+ *    `i + capacity()` are the same memory.
+ *  * Any window of up to `capacity()` elements starting at the head (or
+ *    at the tail, for free space) is therefore contiguous in virtual
+ *    memory: `data()` … `data() + size()` can be handed straight to a
+ *    parser or to `write()`, even when it straddles the wrap point.
+ *  * Power-of-two capacity, automatic doubling growth (one memcpy).
+ *  * `T` must be trivially copyable – an element is visible at two
+ *    addresses, so only bytes may live there.
+ *  * Linux only. C++17 (gem5 compatible).
+ */
+template<class T>
+class MirroredRingQueue {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "MirroredRingQueue requires a trivially copyable T");
+
+  public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    //==========================================================================//
+    //  Construction
+    //==========================================================================//
+
+    /**
+     * @brief Constructs a mirrored queue with at least @p init_cap slots.
+     *
+     * The capacity is rounded up to a power-of-two whose byte size is a
+     * multiple of the page size (the mapping granularity).
+     *
+     * @throws std::system_error if memfd_create / mmap fail.
+     */
+    explicit MirroredRingQueue(std::size_t init_cap = 16)
+    {
+        assert(init_cap > 0 && "initial capacity must be >0");
+        map(round_capacity(init_cap));
+    }
+
+    MirroredRingQueue(const MirroredRingQueue&)            = delete;
+    MirroredRingQueue& operator=(const MirroredRingQueue&) = delete;
+
+    MirroredRingQueue(MirroredRingQueue&& other) noexcept
+        : base_(std::exchange(other.base_, nullptr))
+        , head_(std::exchange(other.head_, 0))
+        , count_(std::exchange(other.count_, 0))
+        , cap_mask_(std::exchange(other.cap_mask_, 0))
+    {}
+
+    MirroredRingQueue& operator=(MirroredRingQueue&& other) noexcept
+    {
+        if (this != &other) {
+            unmap(base_, capacity());
+            base_     = std::exchange(other.base_, nullptr);
+            head_     = std::exchange(other.head_, 0);
+            count_    = std::exchange(other.count_, 0);
+            cap_mask_ = std::exchange(other.cap_mask_, 0);
+        }
+        return *this;
+    }
+
+    ~MirroredRingQueue() { unmap(base_, capacity()); }
+
+    //==========================================================================//
+    //  Core API (same semantics as RingQueue)
+    //==========================================================================//
+
+    void push(const T& val)
+    {
+        const T copy = val;              // val may live in the buffer we regrow
+        ensure_capacity(1);
+        base_[tail()] = copy;
+        ++count_;
+    }
+
+    template<class... Args>
+    T& emplace(Args&&... args)
+    {
+        ensure_capacity(1);
+        T* p = new (base_ + tail()) T(std::forward<Args>(args)...);
+        ++count_;
+        return *p;
+    }
+
+    T& front()             { assert(!empty() && "front() on empty queue"); return base_[head_]; }
+    const T& front() const { assert(!empty() && "front() on empty queue"); return base_[head_]; }
+    T& back()              { assert(!empty() && "back() on empty queue"); return data()[count_ - 1]; }
+    const T& back() const  { assert(!empty() && "back() on empty queue"); return data()[count_ - 1]; }
+
+    /** @brief i-th element from the front. @pre `i < size()`. */
+    T& operator[](std::size_t i)
+    {
+        assert(i < count_ && "operator[] out of range");
+        return data()[i];
+    }
+    const T& operator[](std::size_t i) const
+    {
+        assert(i < count_ && "operator[] out of range");
+        return data()[i];
+    }
+
+    void pop()
+    {
+        assert(!empty() && "pop() on empty queue");
+        head_ = (head_ + 1) & cap_mask_;
+        --count_;
+    }
+
+    /** @brief Appends `[first, first + n)` with a single memcpy. */
+    void push_n(const T* first, std::size_t n)
+    {
+        ensure_capacity(n);
+        std::memcpy(static_cast<void*>(base_ + tail()), first, n * sizeof(T));
+        count_ += n;
+    }
+
+    /** @brief Copies up to @p n front elements to @p out and removes them. */
+    std::size_t pop_n(T* out, std::size_t n)
+    {
+        n = std::min(n, count_);
+        std::memcpy(static_cast<void*>(out), data(), n * sizeof(T));
+        consume(n);
+        return n;
+    }
+
+    void clear() noexcept { head_ = count_ = 0; }
+
+    //==========================================================================//
+    //  Zero-copy window API
+    //==========================================================================//
+
+    /**
+     * @brief Pointer to the front element. `[data(), data() + size())` is
+     *        contiguous, even across the wrap point.
+     */
+    T* data() noexcept { return base_ + head_; }
+    const T* data() const noexcept { return base_ + head_; }
+
+    /**
+     * @brief Removes @p n elements from the front without copying them.
+     *
+     * @pre `n <= size()`.
+     */
+    void consume(std::size_t n) noexcept
+    {
+        assert(n <= count_ && "consume() beyond size()");
+        head_ = (head_ + n) & cap_mask_;
+        count_ -= n;
+    }
+
+    /**
+     * @brief Contiguous free space after the tail, growing so that at
+     *        least @p n slots are available.
+     *
+     * Fill it (e.g. with `read()`) and then call commit().
+     *
+     * @return Pointer to `capacity() - size() >= n` writable slots.
+     */
+    T* prepare(std::size_t n)
+    {
+        ensure_capacity(n);
+        return base_ + tail();
+    }
+
+    /**
+     * @brief Appends @p n slots previously written through prepare().
+     *
+     * @pre `size() + n <= capacity()`.
+     */
+    void commit(std::size_t n) noexcept
+    {
+        assert(count_ + n <= capacity() && "commit() beyond capacity()");
+        count_ += n;
+    }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] bool full() const noexcept { return count_ == capacity(); }
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return base_ ? cap_mask_ + 1 : 0; }
+
+    /** @brief Ensures `capacity() >= n`. */
+    void reserve(std::size_t n)
+    {
+        if (n > capacity()) grow_to(round_capacity(n));
+    }
+
+private:
+    T* base_ = nullptr;              ///< First of the two mappings
+    std::size_t head_ = 0;           ///< Index of oldest element (< capacity)
+    std::size_t count_ = 0;          ///< Live element count
+    std::size_t cap_mask_ = 0;       ///< capacity()-1
+
+    std::size_t tail() const noexcept { return (head_ + count_) & cap_mask_; }
+
+    void ensure_capacity(std::size_t n)
+    {
+        if (count_ + n > capacity()) grow_to(round_capacity(count_ + n));
+    }
+
+    // ----------------------------------------------------------------- //
+    //  Growth: the live range is contiguous, so it is one memcpy.
+    // ----------------------------------------------------------------- //
+    void grow_to(std::size_t new_cap)
+    {
+        MirroredRingQueue bigger(new_cap);
+        std::memcpy(static_cast<void*>(bigger.base_), data(), count_ * sizeof(T));
+        bigger.count_ = count_;
+        *this = std::move(bigger);
+    }
+
+    // Smallest power-of-two >= n whose byte size is a whole number of pages.
+    static std::size_t round_capacity(std::size_t n)
+    {
+        static const std::size_t page = std::size_t(::sysconf(_SC_PAGESIZE));
+        std::size_t cap = ring_queue_detail::next_power_of_two(n);
+        while ((cap * sizeof(T)) % page != 0) cap *= 2;
+        return cap;
+    }
+
+    // ----------------------------------------------------------------- //
+    //  Reserve 2× the span, then map the memfd over both halves.
+    // ----------------------------------------------------------------- //
+    void map(std::size_t cap)
+    {
+        const std::size_t bytes = cap * sizeof(T);
+
+        const int fd = ::memfd_create("ring_queue", MFD_CLOEXEC);
+        if (fd < 0) throw_errno("memfd_create");
+        if (::ftruncate(fd, off_t(bytes)) != 0) {
+            const int err = errno;
+            ::close(fd);
+            throw_errno("ftruncate", err);
+        }
+
+        void* region = ::mmap(nullptr, 2 * bytes, PROT_NONE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (region == MAP_FAILED) {
+            const int err = errno;
+            ::close(fd);
+            throw_errno("mmap", err);
+        }
+
+        char* lo = static_cast<char*>(region);
+        for (char* half : { lo, lo + bytes }) {
+            if (::mmap(half, bytes, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+                const int err = errno;
+                ::munmap(region, 2 * bytes);
+                ::close(fd);
+                throw_errno("mmap", err);
+            }
+        }
+        ::close(fd);                     // the mappings keep the memory alive
+
+        base_     = reinterpret_cast<T*>(lo);
+        cap_mask_ = cap - 1;
+        head_ = count_ = 0;
+    }
+
+    static void unmap(T* base, std::size_t cap) noexcept
+    {
+        if (base) ::munmap(base, 2 * cap * sizeof(T));
+    }
+
+    [[noreturn]] static void throw_errno(const char* what, int err = errno)
+    {
+        throw std::system_error(err, std::generic_category(), what);
+    }
+};
@@ -0,0 +1,202 @@
+// container/ring_queue/mpmc_ring_queue.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <atomic>
+#include <algorithm>
+#include <memory>
+#include <cassert>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @file   mpmc_ring_queue.hh
+ * @brief  Bounded lock-free multi-producer / multi-consumer ring queue.
+ *
+ *  * Same power-of-two layout as RingQueue → wrap-around is `& cap_mask_`.
+ *  * Every slot carries a sequence number that tells producers and
+ *    consumers whose turn it is (Vyukov's bounded MPMC scheme), so
+ *    `try_push` / `try_pop` need one CAS on the shared index and never lock.
+ *  * Fixed capacity (no growth) – `try_push` reports a full queue.
+ *  * T must construct and move-assign without throwing: a claimed slot
+ *    always has to be released to the other side.
+ *  * C++17 (gem5 compatible).
+ */
+template<class T>
+class MpmcRingQueue {
+  public:
+    //==========================================================================//
+    //  Construction
+    //==========================================================================//
+
+    /**
+     * @brief Constructs an MPMC queue holding at least @p cap elements.
+     *
+     * The capacity is rounded up to the next power-of-two, and to at least
+     * 2: with a single slot the "full" sequence (pos + 1) would equal the
+     * "free for the next lap" one (pos + cap).
+     *
+     * @param cap  Desired minimum capacity (default = 1024). Must be > 0.
+     *
+     * @post `capacity()` is a power-of-two >= 2 and the queue is empty.
+     */
+    explicit MpmcRingQueue(std::size_t cap = 1024)
+        : cap_mask_(ring_queue_detail::reserve_power_of_two(std::max<std::size_t>(cap, 2)) - 1)
+        , slots_(std::allocator<Slot>().allocate(cap_mask_ + 1))
+    {
+        assert(cap > 0 && "capacity must be >0");
+        for (std::size_t i = 0; i <= cap_mask_; ++i)
+            new (&slots_[i].seq) std::atomic<std::size_t>(i);
+    }
+
+    MpmcRingQueue(const MpmcRingQueue&)            = delete;
+    MpmcRingQueue& operator=(const MpmcRingQueue&) = delete;
+
+    ~MpmcRingQueue()
+    {
+        // Single-threaded by now: drain whatever is left.
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        for (std::size_t i = head_.load(std::memory_order_relaxed); i != tail; ++i)
+            slots_[i & cap_mask_].value()->~T();
+        for (std::size_t i = 0; i <= cap_mask_; ++i)
+            slots_[i].seq.~atomic();
+        std::allocator<Slot>().deallocate(slots_, cap_mask_ + 1);
+    }
+
+    //==========================================================================//
+    //  Core API (lock-free)
+    //==========================================================================//
+
+    /**
+     * @brief Pushes a value if there is room.
+     *
+     * @return `true` on success, `false` if the queue was full.
+     */
+    template<class U>
+    bool try_push(U&& val)
+    {
+        return try_emplace(std::forward<U>(val));
+    }
+
+    /**
+     * @brief Constructs an element in-place if there is room.
+     *
+     * @return `true` on success, `false` if the queue was full.
+     *
+     * @note The slot is claimed before construction, so `T`'s constructor
+     *       must not throw (enforced at compile time).
+     */
+    template<class... Args>
+    bool try_emplace(Args&&... args)
+    {
+        static_assert(std::is_nothrow_constructible_v<T, Args&&...>,
+                      "MpmcRingQueue requires a noexcept constructor");
+
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots_[pos & cap_mask_];
+            const std::size_t seq = slot->seq.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = std::ptrdiff_t(seq) - std::ptrdiff_t(pos);
+            if (diff == 0) {
+                // Slot is free for lap `pos` – try to claim it.
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;                   // consumer a lap behind → full
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        new (slot->value()) T(std::forward<Args>(args)...);
+        slot->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Moves the oldest element into @p out and removes it.
+     *
+     * The move assignment must not throw: once the slot is claimed it has
+     * to be handed back to the producers.
+     *
+     * @return `true` on success, `false` if the queue was empty.
+     */
+    bool try_pop(T& out)
+    {
+        static_assert(std::is_nothrow_move_assignable_v<T>,
+                      "MpmcRingQueue requires a noexcept move assignment");
+
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots_[pos & cap_mask_];
+            const std::size_t seq = slot->seq.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = std::ptrdiff_t(seq) - std::ptrdiff_t(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;                   // producer not there yet → empty
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+        T* v = slot->value();
+        out = std::move(*v);
+        v->~T();
+        // Hand the slot to the producer of the next lap.
+        slot->seq.store(pos + cap_mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    /**
+     * @brief Approximate number of stored elements.
+     *
+     * Counts claimed slots, including ones still being written or read,
+     * so under contention it is only a hint.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    /** @brief `true` if size() == 0 (same caveats as size()). */
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /** @brief Fixed capacity (always a power-of-two). */
+    [[nodiscard]] std::size_t capacity() const noexcept { return cap_mask_ + 1; }
+
+private:
+    // ----------------------------------------------------------------- //
+    //  Slot: sequence number + raw storage for one T.
+    //
+    //  seq == pos           → empty, waiting for the producer of `pos`
+    //  seq == pos + 1       → full, waiting for the consumer of `pos`
+    //  seq == pos + cap     → empty again, for the next lap
+    // ----------------------------------------------------------------- //
+    struct Slot {
+        std::atomic<std::size_t> seq;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    // Read-only after construction.
+    alignas(ring_queue_detail::kCacheLine)
+    std::size_t cap_mask_;                 ///< capacity()-1
+    Slot* slots_;                          ///< Slot array
+
+    alignas(ring_queue_detail::kCacheLine)
+    std::atomic<std::size_t> tail_{0};     ///< Next position to claim for push
+
+    alignas(ring_queue_detail::kCacheLine)
+    std::atomic<std::size_t> head_{0};     ///< Next position to claim for pop
+};
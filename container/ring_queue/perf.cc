@@ -1,9 +1,20 @@
 // container/ring_queue/perf.cc
 #include "ring_queue.hh"
+#include "static_ring_queue.hh"
+#include "history_queue.hh"
+#include "incremental_ring_queue.hh"
+#include "soa_ring_queue.hh"
+#include "time_buffer.hh"
+#include "small_ring_queue.hh"
 #include <deque>
+#include <cstddef>
+#include <memory_resource>
 #include <chrono>
 #include <random>
 #include <vector>
+#include <array>
+#include <cstdint>
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <cmath>
@@ -48,11 +59,329 @@ Result benchmark(Func&& f, int runs = 8)
     return { mean, stddev, 1e9 / mean };
 }
 
+// ---------------------------------------------------------------------
+//  Per-operation latency: times every call of op(i) on its own and keeps
+//  the samples, so the tail (p99.99, max) is exact rather than averaged.
+// ---------------------------------------------------------------------
+struct LatencyProfile {
+    double p50_ns, p99_ns, p9999_ns, p99999_ns, max_ns;
+    std::array<size_t, 32> log2_hist{};   ///< [k] = samples in [2^k, 2^(k+1)) ns
+};
+
+template<class Op>
+LatencyProfile latency_profile(Op&& op, size_t n)
+{
+    std::vector<uint32_t> samples(n);
+    for (size_t i = 0; i < n; ++i) {
+        auto t0 = Clock::now();
+        op(i);
+        auto t1 = Clock::now();
+        samples[i] = uint32_t(std::min<int64_t>(
+            std::chrono::duration_cast<ns>(t1 - t0).count(), UINT32_MAX));
+    }
+
+    LatencyProfile r;
+    for (uint32_t v : samples) ++r.log2_hist[v ? 31 - __builtin_clz(v) : 0];
+    auto pct = [&](double p) {
+        auto it = samples.begin() + size_t(p * double(n - 1));
+        std::nth_element(samples.begin(), it, samples.end());
+        return double(*it);
+    };
+    r.p50_ns   = pct(0.50);
+    r.p99_ns   = pct(0.99);
+    r.p9999_ns = pct(0.9999);
+    r.p99999_ns = pct(0.99999);
+    r.max_ns   = *std::max_element(samples.begin(), samples.end());
+    return r;
+}
+
 // ---------------------------------------------------------------------
 //  Test element
 // ---------------------------------------------------------------------
 using Element = long;  // Change to Packet for move-only test
 
+/** 64-byte packet with a non-trivial constructor and destructor. */
+struct BigPacket {
+    long id;
+    long payload[7];
+
+    BigPacket() noexcept : id(0), payload{} {}
+    explicit BigPacket(long i) noexcept : id(i), payload{} {}
+    ~BigPacket() { id = -1; }
+};
+static_assert(sizeof(BigPacket) == 64);
+
+// ---------------------------------------------------------------------
+//  Reference: the previous std::vector<T>-backed growth path. Every
+//  doubling value-initialises the whole new buffer before moving in.
+// ---------------------------------------------------------------------
+template<class T>
+struct VectorRing {
+    std::vector<T> data = std::vector<T>(16);
+    std::size_t head = 0, tail = 0, count = 0;
+
+    void push(long v)
+    {
+        if (count == data.size()) {
+            std::vector<T> nd(data.size() * 2);
+            for (std::size_t i = 0; i < count; ++i) {
+                const std::size_t src = (head + i) & (data.size() - 1);
+                new (&nd[i]) T(std::move(data[src]));
+                data[src].~T();
+            }
+            data = std::move(nd);
+            head = 0;
+            tail = count;
+        }
+        new (&data[tail]) T(v);
+        tail = (tail + 1) & (data.size() - 1);
+        ++count;
+    }
+};
+
+// ---------------------------------------------------------------------
+//  Pipeline-buffer loop for Scenario 8. Kept out of line so the queue is
+//  accessed through a reference, as it is when it is a member of a
+//  pipeline stage, rather than being fully scalarised into registers.
+// ---------------------------------------------------------------------
+template<class Q>
+[[gnu::noinline]] long pipeline_loop(Q& q, size_t occupancy, size_t n)
+{
+    long sink = 0;
+    for (size_t i = 0; i < occupancy; ++i) q.push(Element(i));
+    for (size_t i = 0; i < n; ++i) {
+        q.push(Element(i));
+        sink += q.front();
+        q.pop();
+    }
+    return sink;
+}
+
+// ---------------------------------------------------------------------
+//  Scan kernels for Scenario 9
+// ---------------------------------------------------------------------
+[[gnu::noinline]] long sum_by_index(const RingQueue<Element>& q)
+{
+    long sum = 0;
+    for (size_t i = 0; i < q.size(); ++i) sum += q[i];
+    return sum;
+}
+
+[[gnu::noinline]] long sum_by_iter(const RingQueue<Element>& q)
+{
+    long sum = 0;
+    for (Element v : q) sum += v;
+    return sum;
+}
+
+[[gnu::noinline]] long sum_by_segment(const RingQueue<Element>& q)
+{
+    long sum = 0;
+    const auto [a, b] = q.segments();
+    for (Element v : a) sum += v;
+    for (Element v : b) sum += v;
+    return sum;
+}
+
+// ---------------------------------------------------------------------
+//  Trace-buffer loops for Scenario 10: keep the last `cap` events.
+// ---------------------------------------------------------------------
+[[gnu::noinline]] void trace_pop_then_push(RingQueue<Element>& q, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        if (q.full()) q.pop();
+        q.push(Element(i));
+    }
+}
+
+[[gnu::noinline]] void trace_overwrite(HistoryQueue<Element>& q, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) q.push(Element(i));
+}
+
+// ---------------------------------------------------------------------
+//  Reorder-buffer loop for Scenario 12: 4-wide dispatch and retire, and
+//  every 32 cycles a mispredict squashes a random number of the youngest
+//  entries.
+// ---------------------------------------------------------------------
+inline void dispatch(RingQueue<Element>& q, Element v) { q.push(v); }
+inline void dispatch(std::deque<Element>& q, Element v) { q.push_back(v); }
+inline void retire(RingQueue<Element>& q) { q.pop(); }
+inline void retire(std::deque<Element>& q) { q.pop_front(); }
+inline void squash(RingQueue<Element>& q, size_t n) { q.truncate_back(n); }
+inline void squash(std::deque<Element>& q, size_t n) { q.erase(q.end() - ptrdiff_t(n), q.end()); }
+
+template<class Q>
+[[gnu::noinline]] long rob_loop(Q& q, size_t cycles, uint32_t seed)
+{
+    constexpr size_t kWidth = 4, kRobSize = 192;
+    long sink = 0;
+    uint32_t x = seed;
+    for (size_t c = 0; c < cycles; ++c) {
+        for (size_t w = 0; w < kWidth && q.size() < kRobSize; ++w) dispatch(q, Element(c));
+        for (size_t w = 0; w < kWidth && q.size() > kRobSize / 2; ++w) {
+            sink += q.front();
+            retire(q);
+        }
+        if (c % 32 == 31) {
+            x = x * 1664525u + 1013904223u;               // LCG: cheap and identical for both
+            squash(q, (x >> 8) % (q.size() + 1));
+        }
+    }
+    return sink;
+}
+
+// ---------------------------------------------------------------------
+//  Short-lived queues for Scenario 13: each one grows 4 → 32 slots, is
+//  half drained, and is destroyed.
+// ---------------------------------------------------------------------
+template<class Q, class... AllocArg>
+[[gnu::noinline]] long small_queue_cycle(AllocArg&&... alloc)
+{
+    Q q(4, alloc...);
+    for (int i = 0; i < 32; ++i) q.push(Element(i));
+    long sink = 0;
+    for (int i = 0; i < 16; ++i) {
+        sink += q.front();
+        q.pop();
+    }
+    return sink;
+}
+
+// ---------------------------------------------------------------------
+//  Bursty occupancy trace for Scenario 14: fill to ~100K, drain to ~10,
+//  with a push after every third pop so the drain is not monotonic.
+//  Tracks the buffer size after every operation.
+// ---------------------------------------------------------------------
+struct MemoryTrace {
+    size_t ops = 0;
+    size_t peak_bytes = 0;
+    double avg_bytes = 0;
+};
+
+template<class Q, class AfterPop>
+[[gnu::noinline]] MemoryTrace bursty_trace(Q& q, size_t bursts, AfterPop&& after_pop)
+{
+    MemoryTrace t;
+    double sum = 0;
+    auto sample = [&]() {
+        const size_t bytes = q.capacity() * sizeof(Element);
+        t.peak_bytes = std::max(t.peak_bytes, bytes);
+        sum += double(bytes);
+        ++t.ops;
+    };
+    for (size_t b = 0; b < bursts; ++b) {
+        const size_t hi = 90'000 + (b * 7919) % 10'000;
+        while (q.size() < hi) { q.push(Element(b)); sample(); }
+        for (size_t k = 0; q.size() > 10; ++k) {
+            q.pop();
+            after_pop(q);
+            sample();
+            if (k % 3 == 2) { q.push(Element(k)); sample(); }
+        }
+    }
+    t.avg_bytes = sum / double(t.ops);
+    return t;
+}
+
+// ---------------------------------------------------------------------
+//  Timestamp scan for Scenario 15: 48-byte packet records, of which the
+//  consumer reads only the 8-byte timestamp.
+// ---------------------------------------------------------------------
+struct PacketRec {
+    uint64_t ts;
+    uint64_t addr;
+    uint64_t seq;
+    uint32_t id;
+    uint32_t len;
+    uint64_t meta[2];
+};
+static_assert(sizeof(PacketRec) == 48);
+
+using PacketSoa = SoaRingQueue<uint64_t, uint64_t, uint64_t, uint32_t, uint32_t, uint64_t, uint64_t>;
+
+[[gnu::noinline]] size_t count_ready(const RingQueue<PacketRec>& q, uint64_t now)
+{
+    size_t n = 0;
+    const auto [a, b] = q.segments();
+    for (const PacketRec& p : a) n += p.ts <= now;
+    for (const PacketRec& p : b) n += p.ts <= now;
+    return n;
+}
+
+[[gnu::noinline]] size_t count_ready(const PacketSoa& q, uint64_t now)
+{
+    size_t n = 0;
+    const auto [a, b] = q.segments<0>();
+    for (uint64_t ts : a) n += ts <= now;
+    for (uint64_t ts : b) n += ts <= now;
+    return n;
+}
+
+// ---------------------------------------------------------------------
+//  Fixed-latency pipe for Scenario 16: every cycle 0–8 entries enter with
+//  ready = cycle + latency; every `poll` cycles the consumer takes all
+//  that are ready (poll > 1: a slower clock domain, or an event-driven
+//  consumer that wakes up late). Both consumers hand the ready values
+//  over through the same output buffer.
+// ---------------------------------------------------------------------
+[[gnu::noinline]] long delay_front_check(RingQueue<std::pair<uint64_t, Element>>& q,
+                                         const std::vector<uint8_t>& widths,
+                                         uint64_t latency, uint64_t poll)
+{
+    long sink = 0;
+    std::vector<Element> out(8 * poll);
+    for (uint64_t c = 0; c < widths.size(); ++c) {
+        for (uint8_t w = 0; w < widths[c]; ++w) q.push(std::pair{ c + latency, Element(c) });
+        if (c % poll) continue;
+        size_t n = 0;
+        while (!q.empty() && q.front().first <= c) {
+            out[n++] = q.front().second;
+            q.pop();
+        }
+        for (size_t i = 0; i < n; ++i) sink += out[i];
+    }
+    return sink;
+}
+
+[[gnu::noinline]] long delay_time_buffer(TimeBuffer<Element>& tb,
+                                         const std::vector<uint8_t>& widths,
+                                         uint64_t latency, uint64_t poll)
+{
+    long sink = 0;
+    std::vector<Element> out(8 * poll);
+    for (uint64_t c = 0; c < widths.size(); ++c) {
+        for (uint8_t w = 0; w < widths[c]; ++w) tb.push(Element(c), c + latency);
+        if (c % poll) continue;
+        const size_t n = tb.pop_ready(c, out.data());
+        for (size_t i = 0; i < n; ++i) sink += out[i];
+    }
+    return sink;
+}
+
+// ---------------------------------------------------------------------
+//  Per-port queues for Scenario 17: each visit pushes a burst of 0–4 and
+//  drains down to 0–4, so no queue ever holds more than 8.
+// ---------------------------------------------------------------------
+template<class Q>
+[[gnu::noinline]] long port_traffic(std::vector<Q>& ports, const std::vector<uint8_t>& plan,
+                                    size_t rounds)
+{
+    long sink = 0;
+    size_t k = 0;
+    for (size_t r = 0; r < rounds; ++r) {
+        for (Q& q : ports) {
+            const uint8_t step = plan[k++ & (plan.size() - 1)];
+            for (uint8_t j = 0; j < (step & 7) % 5; ++j) q.push(Element(j));
+            while (q.size() > size_t(step >> 4)) {
+                sink += q.front();
+                q.pop();
+            }
+        }
+    }
+    return sink;
+}
+
 // ---------------------------------------------------------------------
 //  Main
 // ---------------------------------------------------------------------
@@ -207,6 +536,380 @@ int main()
                   << "   Speedup: " << d5.mean_ns / r5.mean_ns << "×\n\n";
     }
 
+    // -----------------------------------------------------------------
+    //  Scenario 6: Growth cost, raw storage vs std::vector<T> storage
+    // -----------------------------------------------------------------
+    {
+        constexpr size_t G = (size_t(1) << 22) + 1;   // last push doubles again
+        std::cout << "6. Grow from 16 to " << G << " elements (raw vs vector storage)\n";
+
+        auto run = [&](auto tag, const char* name) {
+            using T = decltype(tag);
+            auto raw = [&]() {
+                RingQueue<T> q;
+                for (size_t i = 0; i < G; ++i) q.push(T(long(i)));
+            };
+            auto vec = [&]() {
+                VectorRing<T> q;
+                for (size_t i = 0; i < G; ++i) q.push(long(i));
+            };
+            auto r6 = benchmark(raw);
+            auto v6 = benchmark(vec);
+            std::cout << "   " << name << "\n"
+                      << "     RingQueue (raw):  " << r6.mean_ns / 1e6 << " ms\n"
+                      << "     vector storage:   " << v6.mean_ns / 1e6 << " ms\n"
+                      << "     Speedup: " << v6.mean_ns / r6.mean_ns << "×\n";
+        };
+        run(long{}, "long");
+        run(BigPacket{}, "BigPacket (64 B, non-trivial)");
+        std::cout << "\n";
+    }
+
+    // -----------------------------------------------------------------
+    //  Scenario 7: Burst push/pop, per-element vs push_n / pop_n
+    // -----------------------------------------------------------------
+    {
+        constexpr size_t M = N / 10;
+        std::cout << "7. Bursts of B add + B pop (" << M << " elements per B)\n"
+                  << "      B |  per-element (ms) |  push_n/pop_n (ms) | Speedup\n";
+
+        for (size_t B = 1; B <= 1024; B *= 2) {
+            std::vector<Element> in(B), out(B);
+            for (size_t j = 0; j < B; ++j) in[j] = Element(j);
+
+            auto per_elem = [&]() {
+                RingQueue<Element> q;
+                for (size_t i = 0; i < M; i += B) {
+                    for (size_t j = 0; j < B; ++j) q.push(in[j]);
+                    for (size_t j = 0; j < B; ++j) { out[j] = q.front(); q.pop(); }
+                }
+            };
+            auto bulk = [&]() {
+                RingQueue<Element> q;
+                for (size_t i = 0; i < M; i += B) {
+                    q.push_n(in.data(), in.data() + B);
+                    q.pop_n(out.data(), B);
+                }
+            };
+
+            auto e7 = benchmark(per_elem);
+            auto b7 = benchmark(bulk);
+            std::cout << "   " << std::setw(4) << B << " | "
+                      << std::setw(17) << e7.mean_ns / 1e6 << " | "
+                      << std::setw(18) << b7.mean_ns / 1e6 << " | "
+                      << e7.mean_ns / b7.mean_ns << "×\n";
+        }
+        std::cout << "\n";
+    }
+
+    // -----------------------------------------------------------------
+    //  Scenario 8: Fixed-size pipeline buffer, StaticRingQueue vs RingQueue
+    // -----------------------------------------------------------------
+    {
+        constexpr size_t CAP = 64;
+        std::cout << "8. Fixed " << CAP << "-entry buffer, half full, 1 add + 1 pop ("
+                  << N << " pairs)\n";
+
+        volatile long sink = 0;
+        auto dyn = [&]() { RingQueue<Element> q(CAP); sink = sink + pipeline_loop(q, CAP / 2, N); };
+        auto fix = [&]() { StaticRingQueue<Element, CAP> q; sink = sink + pipeline_loop(q, CAP / 2, N); };
+
+        auto d8 = benchmark(dyn);
+        auto s8 = benchmark(fix);
+        std::cout << "   RingQueue:       " << d8.mean_ns / 1e6 << " ms\n"
+                  << "   StaticRingQueue: " << s8.mean_ns / 1e6 << " ms\n"
+                  << "   Speedup: " << d8.mean_ns / s8.mean_ns << "×\n\n";
+    }
+
+    // -----------------------------------------------------------------
+    //  Scenario 9: Scan a wrapped queue – operator[] vs iterators vs segments
+    // -----------------------------------------------------------------
+    {
+        constexpr size_t S = size_t(1) << 14;          // L1/L2 resident
+        constexpr int PASSES = 20'000;
+        std::cout << "9. Sum a wrapped " << S << "-element queue (" << PASSES << " passes)\n";
+
+        RingQueue<Element> q(S);
+        for (size_t i = 0; i < S / 2; ++i) q.push(Element(i));
+        for (size_t i = 0; i < S / 2; ++i) q.pop();
+        for (size_t i = 0; i < S; ++i) q.push(Element(i));   // head at the middle
+
+        volatile long sink = 0;
+        auto by_index = [&]() {
+            for (int p = 0; p < PASSES; ++p) sink = sink + sum_by_index(q);
+        };
+        auto by_iter = [&]() {
+            for (int p = 0; p < PASSES; ++p) sink = sink + sum_by_iter(q);
+        };
+        auto by_segment = [&]() {
+            for (int p = 0; p < PASSES; ++p) sink = sink + sum_by_segment(q);
+        };
+
+        auto i9 = benchmark(by_index);
+        auto t9 = benchmark(by_iter);
+        auto s9 = benchmark(by_segment);
+        std::cout << "   operator[]: " << i9.mean_ns / 1e6 << " ms\n"
+                  << "   iterators:  " << t9.mean_ns / 1e6 << " ms\n"
+                  << "   segments(): " << s9.mean_ns / 1e6 << " ms\n"
+                  << "   Speedup (segments vs operator[]): " << i9.mean_ns / s9.mean_ns << "×\n\n";
+    }
+
+    // -----------------------------------------------------------------
+    //  Scenario 10: "Last N events" trace, pop-if-full + push vs HistoryQueue
+    // -----------------------------------------------------------------
+    {
+        constexpr size_t CAP = 1024;
+        std::cout << "10. Keep last " << CAP << " of " << N << " events\n";
+
+        RingQueue<Element> rq(CAP);
+        HistoryQueue<Element> hq(CAP);
+        auto ring    = [&]() { rq.clear(); trace_pop_then_push(rq, N); };
+        auto history = [&]() { hq.clear(); trace_overwrite(hq, N); };
+
+        auto r10 = benchmark(ring);
+        auto h10 = benchmark(history);
+        assert(rq.back() == hq.back() && rq.front() == hq.front());
+        std::cout << "   RingQueue pop+push: " << r10.mean_ns / 1e6 << " ms\n"
+                  << "   HistoryQueue push:  " << h10.mean_ns / 1e6 << " ms\n"
+                  << "   Speedup: " << r10.mean_ns / h10.mean_ns << "×\n\n";
+    }
+
+    // -----------------------------------------------------------------
+    //  Scenario 11: push latency, doubling growth vs incremental growth
+    // -----------------------------------------------------------------
+    {
+        constexpr size_t L = N / 4;
+        std::cout << "11. Per-push latency while growing to " << L << " elements\n";
+
+        LatencyProfile r11, i11;
+        {
+            RingQueue<Element> q;
+            r11 = latency_profile([&](size_t i) { q.push(Element(i)); }, L);
+        }
+        {
+            IncrementalRingQueue<Element> q;
+            i11 = latency_profile([&](size_t i) { q.push(Element(i)); }, L);
+        }
+
+        auto row = [](const char* name, const LatencyProfile& r) {
+            std::cout << "   " << name << "p50 " << r.p50_ns << " ns, p99 " << r.p99_ns
+                      << " ns, p99.99 " << r.p9999_ns << " ns, p99.999 " << r.p99999_ns / 1e3
+                      << " us, max " << r.max_ns / 1e6 << " ms\n";
+        };
+        row("RingQueue:            ", r11);
+        row("IncrementalRingQueue: ", i11);
+
+        std::cout << "   Histogram (ns)        RingQueue  Incremental\n";
+        for (size_t k = 0; k < r11.log2_hist.size(); ++k) {
+            if (!r11.log2_hist[k] && !i11.log2_hist[k]) continue;
+            std::cout << "   [2^" << std::setw(2) << k << ", 2^" << std::setw(2) << k + 1 << ")  "
+                      << std::setw(11) << r11.log2_hist[k] << "  "
+                      << std::setw(11) << i11.log2_hist[k] << "\n";
+        }
+        // Both queues take a first-touch page fault every 4 KiB of new
+        // buffer; the growth stall itself sits above that.
+        std::cout << "   p99.99 improvement:  " << r11.p9999_ns / i11.p9999_ns << "×\n"
+                  << "   p99.999 improvement: " << r11.p99999_ns / i11.p99999_ns << "×\n"
+                  << "   Max improvement:     " << r11.max_ns / i11.max_ns << "×\n\n";
+    }
+
+    // -----------------------------------------------------------------
+    //  Scenario 12: Reorder buffer with squashes, RingQueue vs std::deque
+    // -----------------------------------------------------------------
+    {
+        const size_t C = N / 4;
+        std::cout << "12. ROB model, " << C << " cycles, truncate_back squash\n";
+
+        volatile long sink = 0;
+        auto rq = [&]() { RingQueue<Element> q(256); sink = sink + rob_loop(q, C, SEED); };
+        auto dq = [&]() { std::deque<Element> q; sink = sink + rob_loop(q, C, SEED); };
+
+        auto r12 = benchmark(rq);
+        auto d12 = benchmark(dq);
+        std::cout << "   RingQueue:  " << r12.mean_ns / 1e6 << " ms\n"
+                  << "   std::deque: " << d12.mean_ns / 1e6 << " ms\n"
+                  << "   Speedup: " << d12.mean_ns / r12.mean_ns << "×\n\n";
+    }
+
+    // -----------------------------------------------------------------
+    //  Scenario 13: Many short-lived queues, default heap vs pmr arena
+    // -----------------------------------------------------------------
+    {
+        const size_t Q = N / 100;
+        constexpr size_t BATCH = 1024;                  // queues per arena
+        std::cout << "13. Create/destroy " << Q << " small queues (4 → 32 slots)\n";
+
+        using PmrQueue = RingQueue<Element, std::pmr::polymorphic_allocator<Element>>;
+        std::vector<std::byte> buf(BATCH * 64 * sizeof(Element) * 2);
+
+        volatile long sink = 0;
+        auto heap = [&]() {
+            for (size_t i = 0; i < Q; ++i) sink = sink + small_queue_cycle<RingQueue<Element>>();
+        };
+        auto pmr_heap = [&]() {
+            for (size_t i = 0; i < Q; ++i)
+                sink = sink + small_queue_cycle<PmrQueue>(std::pmr::new_delete_resource());
+        };
+        auto arena = [&]() {
+            for (size_t i = 0; i < Q; i += BATCH) {
+                std::pmr::monotonic_buffer_resource mbr(buf.data(), buf.size());
+                for (size_t j = 0; j < BATCH; ++j) sink = sink + small_queue_cycle<PmrQueue>(&mbr);
+            }
+        };
+
+        auto h13 = benchmark(heap);
+        auto p13 = benchmark(pmr_heap);
+        auto a13 = benchmark(arena);
+        std::cout << "   std::allocator:             " << h13.mean_ns / 1e6 << " ms\n"
+                  << "   pmr, new_delete_resource:   " << p13.mean_ns / 1e6 << " ms\n"
+                  << "   pmr, monotonic arena:       " << a13.mean_ns / 1e6 << " ms\n"
+                  << "   Speedup (arena vs std::allocator): " << h13.mean_ns / a13.mean_ns << "×\n\n";
+    }
+
+    // -----------------------------------------------------------------
+    //  Scenario 14: Bursty occupancy (10 ↔ 100K), growth / shrink policies
+    // -----------------------------------------------------------------
+    {
+        const size_t B = N / 500'000;
+        std::cout << "14. Bursty trace, " << B << " bursts of 10 → ~100K → 10\n";
+
+        using Never      = RingQueue<Element>;
+        using Hysteresis = RingQueue<Element, std::allocator<Element>, RingGrowthPolicy<2, 0, 16, 8>>;
+        auto nothing = [](auto&) {};
+        auto eager   = [](auto& q) { q.shrink_to_fit(); };
+
+        MemoryTrace tr[3];
+        auto never = [&]() { Never q; tr[0] = bursty_trace(q, B, nothing); };
+        auto manual = [&]() { Never q; tr[1] = bursty_trace(q, B, eager); };
+        auto policy = [&]() { Hysteresis q; tr[2] = bursty_trace(q, B, nothing); };
+
+        const Result r[3] = { benchmark(never), benchmark(manual), benchmark(policy) };
+        const char* names[3] = { "Never shrink:             ",
+                                 "shrink_to_fit() per pop:  ",
+                                 "Policy <2,0,16,8>:        " };
+        for (int k = 0; k < 3; ++k) {
+            std::cout << "   " << names[k] << std::setw(8) << r[k].mean_ns / 1e6 << " ms, "
+                      << std::setw(6) << tr[k].ops / (r[k].mean_ns / 1e3) << " Mops/s, peak "
+                      << tr[k].peak_bytes / 1024 << " KiB, avg "
+                      << size_t(tr[k].avg_bytes / 1024) << " KiB\n";
+        }
+        std::cout << "\n";
+    }
+
+    // -----------------------------------------------------------------
+    //  Scenario 15: Timestamp scan, RingQueue<struct> vs SoaRingQueue
+    // -----------------------------------------------------------------
+    {
+        constexpr size_t S = size_t(1) << 16;          // 3 MiB of records
+        constexpr int PASSES = 2'000;
+        std::cout << "15. Count ready packets in a wrapped " << S << "-record queue ("
+                  << PASSES << " passes)\n";
+
+        RingQueue<PacketRec> aos(S);
+        PacketSoa soa(S);
+        for (size_t i = 0; i < S / 2; ++i) {
+            aos.push(PacketRec{});
+            soa.push(0, 0, 0, 0, 0, 0, 0);
+        }
+        for (size_t i = 0; i < S / 2; ++i) aos.pop();
+        soa.consume(S / 2);
+        for (size_t i = 0; i < S; ++i) {                       // head at the middle
+            const PacketRec p{ i * 7, i, i, uint32_t(i), 64, { i, i } };
+            aos.push(p);
+            soa.push(p.ts, p.addr, p.seq, p.id, p.len, p.meta[0], p.meta[1]);
+        }
+
+        volatile size_t sink = 0;
+        auto scan_aos = [&]() {
+            for (int p = 0; p < PASSES; ++p) sink = sink + count_ready(aos, uint64_t(p) * 200);
+        };
+        auto scan_soa = [&]() {
+            for (int p = 0; p < PASSES; ++p) sink = sink + count_ready(soa, uint64_t(p) * 200);
+        };
+        if (count_ready(aos, S * 3) != count_ready(soa, S * 3)) std::cerr << "   MISMATCH\n";
+
+        auto a15 = benchmark(scan_aos);
+        auto s15 = benchmark(scan_soa);
+        std::cout << "   RingQueue<PacketRec>: " << a15.mean_ns / 1e6 << " ms\n"
+                  << "   SoaRingQueue column:  " << s15.mean_ns / 1e6 << " ms\n"
+                  << "   Speedup: " << a15.mean_ns / s15.mean_ns << "×\n\n";
+    }
+
+    // -----------------------------------------------------------------
+    //  Scenario 16: Delay line, front() check per cycle vs TimeBuffer
+    // -----------------------------------------------------------------
+    {
+        const size_t C = N / 10;
+        std::cout << "16. Fixed-latency pipe, " << C << " cycles, 0-8 entries per cycle,\n"
+                  << "    front() loop on RingQueue<pair> vs TimeBuffer::pop_ready\n";
+
+        std::mt19937 rng(SEED);
+        std::vector<uint8_t> widths(C);
+        for (auto& w : widths) w = uint8_t(rng() % 9);
+
+        for (uint64_t poll : { 1, 16 }) {
+            std::cout << "   consumer polls every " << poll << " cycle(s)\n";
+            for (uint64_t latency : { 1, 10, 100, 1000 }) {
+                volatile long sink = 0;
+                auto front_check = [&]() {
+                    RingQueue<std::pair<uint64_t, Element>> q;
+                    sink = sink + delay_front_check(q, widths, latency, poll);
+                };
+                auto time_buffer = [&]() {
+                    TimeBuffer<Element> tb;
+                    sink = sink + delay_time_buffer(tb, widths, latency, poll);
+                };
+                auto f16 = benchmark(front_check);
+                auto t16 = benchmark(time_buffer);
+                std::cout << "     latency " << std::setw(4) << latency << ": front() loop "
+                          << std::setw(7) << f16.mean_ns / 1e6 << " ms, pop_ready "
+                          << std::setw(7) << t16.mean_ns / 1e6 << " ms, speedup "
+                          << f16.mean_ns / t16.mean_ns << "×\n";
+            }
+        }
+        std::cout << "\n";
+    }
+
+    // -----------------------------------------------------------------
+    //  Scenario 17: 10K tiny per-port queues, RingQueue vs SmallRingQueue
+    // -----------------------------------------------------------------
+    {
+        constexpr size_t PORTS = 10'000;
+        const size_t ROUNDS = N / PORTS / 10;
+        std::cout << "17. " << PORTS << " per-port queues holding 0-8 elements\n";
+
+        volatile long sink = 0;
+        auto rq_make = [&]() {
+            std::vector<RingQueue<Element>> ports(PORTS);
+            sink = sink + long(ports.back().capacity());
+        };
+        auto sq_make = [&]() {
+            std::vector<SmallRingQueue<Element, 8>> ports(PORTS);
+            sink = sink + long(ports.back().capacity());
+        };
+        auto r17 = benchmark(rq_make);
+        auto s17 = benchmark(sq_make);
+        std::cout << "   construct + destroy all:\n"
+                  << "     RingQueue:         " << r17.mean_ns / 1e3 << " us\n"
+                  << "     SmallRingQueue<8>: " << s17.mean_ns / 1e3 << " us\n"
+                  << "     Speedup: " << r17.mean_ns / s17.mean_ns << "×\n";
+
+        std::mt19937 rng(SEED);
+        std::vector<uint8_t> plan(size_t(1) << 16);
+        for (auto& p : plan) p = uint8_t((rng() % 5) << 4 | rng() % 8);
+
+        std::vector<RingQueue<Element>> rq_ports(PORTS);
+        std::vector<SmallRingQueue<Element, 8>> sq_ports(PORTS);
+        auto rq_run = [&]() { sink = sink + port_traffic(rq_ports, plan, ROUNDS); };
+        auto sq_run = [&]() { sink = sink + port_traffic(sq_ports, plan, ROUNDS); };
+        auto rr = benchmark(rq_run);
+        auto sr = benchmark(sq_run);
+        std::cout << "   push/pop, " << ROUNDS << " rounds over all ports:\n"
+                  << "     RingQueue:         " << rr.mean_ns / 1e6 << " ms\n"
+                  << "     SmallRingQueue<8>: " << sr.mean_ns / 1e6 << " ms\n"
+                  << "     Speedup: " << rr.mean_ns / sr.mean_ns << "×\n\n";
+    }
+
     std::cout << "All benchmarks complete.\n";
     return 0;
 }
@@ -0,0 +1,133 @@
+// container/ring_queue/perf_blocking.cc
+// BlockingRingQueue vs polling an MpmcRingQueue: saturated throughput
+// (the fast path must cost the same), and a trickle of messages where the
+// consumer is mostly idle (CPU burnt while waiting, wakeup latency).
+
+#include "perf_util.hh"
+#include "mpmc_ring_queue.hh"
+#include "blocking_ring_queue.hh"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+#include <sys/resource.h>
+
+using Clock = std::chrono::steady_clock;
+using ns    = std::chrono::nanoseconds;
+
+constexpr std::size_t N        = 10'000'000;   // transfers, saturated run
+constexpr std::size_t CAPACITY = 4096;
+constexpr std::size_t TRICKLE  = 500;          // messages, idle run
+constexpr auto        GAP      = std::chrono::milliseconds(2);
+
+// Both queues behind the same interface: the poller retries try_pop,
+// the blocking queue parks.
+struct Polling {
+    MpmcRingQueue<long> q{CAPACITY};
+    void push(long v) { while (!q.try_push(v)) spin(); }
+    bool pop(long& v) { while (!q.try_pop(v)) spin(); return true; }
+};
+
+struct Blocking {
+    BlockingRingQueue<long> q{CAPACITY};
+    void push(long v) { q.push(v); }
+    bool pop(long& v) { return q.pop(v); }
+};
+
+static double cpu_ms()
+{
+    rusage ru{};
+    ::getrusage(RUSAGE_SELF, &ru);
+    return (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1e3
+         + (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) / 1e3;
+}
+
+// ---------------------------------------------------------------------
+//  1 producer → 1 consumer, as fast as possible
+// ---------------------------------------------------------------------
+template<class Q>
+double saturated_ms()
+{
+    Q q;
+    std::thread consumer([&] {
+        long v;
+        for (std::size_t i = 0; i < N; ++i) q.pop(v);
+    });
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < N; ++i) q.push(long(i));
+    consumer.join();
+    auto end = Clock::now();
+    return std::chrono::duration_cast<ns>(end - start).count() / 1e6;
+}
+
+// ---------------------------------------------------------------------
+//  One message every GAP: the consumer is idle almost all the time.
+//  Each message carries its send time; the consumer records the delay.
+// ---------------------------------------------------------------------
+struct Trickle {
+    double cpu_pct;                      ///< process CPU / wall time
+    double p50_us, p99_us, max_us;       ///< push → pop latency
+};
+
+template<class Q>
+Trickle trickle()
+{
+    Q q;
+    std::vector<double> lat;
+    lat.reserve(TRICKLE);
+
+    std::thread consumer([&] {
+        long stamp = 0;
+        for (std::size_t i = 0; i < TRICKLE; ++i) {
+            q.pop(stamp);
+            const long now = std::chrono::duration_cast<ns>(
+                Clock::now().time_since_epoch()).count();
+            lat.push_back((now - stamp) / 1e3);
+        }
+    });
+
+    const double cpu0 = cpu_ms();
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < TRICKLE; ++i) {
+        std::this_thread::sleep_for(GAP);
+        q.push(std::chrono::duration_cast<ns>(Clock::now().time_since_epoch()).count());
+    }
+    consumer.join();
+    const double wall = std::chrono::duration_cast<ns>(Clock::now() - start).count() / 1e6;
+    const double cpu  = cpu_ms() - cpu0;
+
+    std::sort(lat.begin(), lat.end());
+    return { 100.0 * cpu / wall, lat[lat.size() / 2],
+             lat[lat.size() * 99 / 100], lat.back() };
+}
+
+int main()
+{
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=== BlockingRingQueue vs polling MpmcRingQueue ("
+              << std::thread::hardware_concurrency() << " hw threads) ===\n";
+
+    const double poll_ms  = saturated_ms<Polling>();
+    const double block_ms = saturated_ms<Blocking>();
+    std::cout << "\nSaturated 1P x 1C, " << N << " transfers\n"
+              << "  polling  : " << std::setw(9) << poll_ms  << " ms  ("
+              << N / poll_ms / 1e3  << " Mops/s)\n"
+              << "  blocking : " << std::setw(9) << block_ms << " ms  ("
+              << N / block_ms / 1e3 << " Mops/s)\n";
+
+    const Trickle p = trickle<Polling>();
+    const Trickle b = trickle<Blocking>();
+    std::cout << "\nTrickle, " << TRICKLE << " messages "
+              << std::chrono::milliseconds(GAP).count() << " ms apart\n"
+              << "             CPU%   lat p50 us   p99 us   max us\n";
+    for (auto [name, r] : { std::pair{ "polling ", p }, std::pair{ "blocking", b } }) {
+        std::cout << "  " << name << std::setw(8) << r.cpu_pct
+                  << std::setw(13) << r.p50_us << std::setw(9) << r.p99_us
+                  << std::setw(9) << r.max_us << '\n';
+    }
+    return 0;
+}
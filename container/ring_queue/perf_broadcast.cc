@@ -0,0 +1,215 @@
+// container/ring_queue/perf_broadcast.cc
+// One event stream, three observers (stats, tracer, checker): a copy of
+// every event into one queue per observer vs one broadcast ring with a
+// cursor per observer. Single-threaded (RingQueue x3 vs
+// BroadcastRingQueue) and one thread per observer (SpscRingQueue x3 vs
+// SpmcBroadcastRingQueue).
+
+#include "perf_util.hh"
+#include "spsc_ring_queue.hh"
+#include "broadcast_ring_queue.hh"
+#include <array>
+#include <memory>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <stdexcept>
+
+using Clock = std::chrono::steady_clock;
+using ns    = std::chrono::nanoseconds;
+
+constexpr std::size_t N         = 20'000'000;  // events
+constexpr std::size_t BATCH     = 64;          // observers run every BATCH events
+constexpr std::size_t OBSERVERS = 3;
+constexpr std::size_t CAPACITY  = 1024;        // threaded rings
+
+struct Event {                                 // 32 bytes
+    std::uint64_t cycle;
+    std::uint64_t addr;
+    std::uint64_t data;
+    std::uint32_t pc;
+    std::uint32_t kind;
+};
+
+Event make_event(std::uint64_t i)
+{
+    return { i, i * 64, i ^ 0x5bd1e995, std::uint32_t(i * 4), std::uint32_t(i % 7) };
+}
+
+// ---------------------------------------------------------------------
+//  The observers; each folds a run of events into one word.
+// ---------------------------------------------------------------------
+struct Observers {
+    std::array<std::uint64_t, 8> kinds{};      // stats: events per kind
+    std::uint64_t trace = 0;                   // tracer: running hash
+    std::uint64_t last_cycle = 0, errors = 0;  // checker: cycles increase
+
+    void observe(std::size_t who, const Event* run, std::size_t len)
+    {
+        switch (who) {
+            case 0: for (std::size_t i = 0; i < len; ++i) ++kinds[run[i].kind]; break;
+            case 1: for (std::size_t i = 0; i < len; ++i) trace = (trace ^ run[i].addr ^ run[i].pc) * 0x100000001b3ull; break;
+            default:
+                for (std::size_t i = 0; i < len; ++i) {
+                    errors += run[i].cycle < last_cycle;
+                    last_cycle = run[i].cycle;
+                }
+        }
+    }
+
+    std::uint64_t digest() const
+    {
+        std::uint64_t d = trace ^ errors ^ last_cycle;
+        for (std::uint64_t k : kinds) d = d * 31 + k;
+        return d;
+    }
+};
+
+// ---------------------------------------------------------------------
+//  Single thread: the simulator pushes, and every BATCH events lets each
+//  observer walk what it has not seen yet.
+// ---------------------------------------------------------------------
+[[gnu::noinline]] std::uint64_t fanout_single()
+{
+    std::array<RingQueue<Event>, OBSERVERS> qs;
+    Observers obs;
+    for (std::size_t i = 0; i < N; ++i) {
+        const Event e = make_event(i);
+        for (auto& q : qs) q.push(e);
+        if ((i + 1) % BATCH) continue;
+        for (std::size_t o = 0; o < OBSERVERS; ++o) {
+            const auto [a, b] = qs[o].segments();
+            obs.observe(o, a.data(), a.size());
+            obs.observe(o, b.data(), b.size());
+            qs[o].truncate_front(a.size() + b.size());
+        }
+    }
+    return obs.digest();
+}
+
+[[gnu::noinline]] std::uint64_t broadcast_single()
+{
+    BroadcastRingQueue<Event> q(OBSERVERS);
+    Observers obs;
+    for (std::size_t i = 0; i < N; ++i) {
+        q.push(make_event(i));
+        if ((i + 1) % BATCH) continue;
+        for (std::size_t o = 0; o < OBSERVERS; ++o) {
+            const auto [a, b] = q.segments(o);
+            obs.observe(o, a.data(), a.size());
+            obs.observe(o, b.data(), b.size());
+            q.consume(o, a.size() + b.size());
+        }
+    }
+    return obs.digest();
+}
+
+// ---------------------------------------------------------------------
+//  One thread per observer
+// ---------------------------------------------------------------------
+std::uint64_t fanout_threads()
+{
+    std::vector<std::unique_ptr<SpscRingQueue<Event>>> qs;
+    for (std::size_t o = 0; o < OBSERVERS; ++o)
+        qs.push_back(std::make_unique<SpscRingQueue<Event>>(CAPACITY));
+    std::array<Observers, OBSERVERS> obs;
+
+    std::vector<std::thread> threads;
+    for (std::size_t o = 0; o < OBSERVERS; ++o) {
+        threads.emplace_back([&, o] {
+            for (std::size_t seen = 0; seen < N;) {
+                const Event* e = qs[o]->front();
+                if (!e) { spin(); continue; }
+                obs[o].observe(o, e, 1);
+                qs[o]->pop();
+                ++seen;
+            }
+        });
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        const Event e = make_event(i);
+        for (auto& q : qs) while (!q->try_push(e)) spin();
+    }
+    for (auto& t : threads) t.join();
+
+    Observers merged = obs[0];
+    merged.trace = obs[1].trace;
+    merged.last_cycle = obs[2].last_cycle;
+    merged.errors = obs[2].errors;
+    return merged.digest();
+}
+
+std::uint64_t broadcast_threads()
+{
+    SpmcBroadcastRingQueue<Event> q(OBSERVERS, CAPACITY);
+    std::array<Observers, OBSERVERS> obs;
+
+    std::vector<std::thread> threads;
+    for (std::size_t o = 0; o < OBSERVERS; ++o) {
+        threads.emplace_back([&, o] {
+            for (std::size_t seen = 0; seen < N;) {
+                const auto [a, b] = q.segments(o);
+                if (a.empty()) { spin(); continue; }
+                obs[o].observe(o, a.data(), a.size());
+                obs[o].observe(o, b.data(), b.size());
+                q.consume(o, a.size() + b.size());
+                seen += a.size() + b.size();
+            }
+        });
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        const Event e = make_event(i);
+        while (!q.try_push(e)) spin();
+    }
+    for (auto& t : threads) t.join();
+
+    Observers merged = obs[0];
+    merged.trace = obs[1].trace;
+    merged.last_cycle = obs[2].last_cycle;
+    merged.errors = obs[2].errors;
+    return merged.digest();
+}
+
+// ---------------------------------------------------------------------
+//  Main
+// ---------------------------------------------------------------------
+template<class F>
+double best_ms(F&& f, std::uint64_t& result, int runs = 3)
+{
+    double best = 1e300;
+    for (int r = 0; r < runs; ++r) {
+        const auto start = Clock::now();
+        result = f();
+        best = std::min(best, std::chrono::duration_cast<ns>(Clock::now() - start).count() / 1e6);
+    }
+    return best;
+}
+
+int main()
+{
+    std::cout << "\n=== Broadcast to " << OBSERVERS << " observers, " << N << " events of "
+              << sizeof(Event) << " B ===\n\n" << std::fixed << std::setprecision(1);
+
+    std::uint64_t r1 = 0, r2 = 0;
+    const double f1 = best_ms(fanout_single, r1);
+    const double b1 = best_ms(broadcast_single, r2);
+    if (r1 != r2) throw std::runtime_error("single-threaded results differ");
+    std::cout << "1. Single thread, observers run every " << BATCH << " events\n"
+              << "   RingQueue x" << OBSERVERS << " fan-out: " << std::setw(8) << f1 << " ms\n"
+              << "   BroadcastRingQueue:   " << std::setw(8) << b1 << " ms\n"
+              << "   Speedup: " << std::setprecision(2) << f1 / b1 << "×\n\n" << std::setprecision(1);
+
+    const double f2 = best_ms(fanout_threads, r1);
+    const double b2 = best_ms(broadcast_threads, r2);
+    if (r1 != r2) throw std::runtime_error("threaded results differ");
+    std::cout << "2. One thread per observer, capacity " << CAPACITY << " ("
+              << std::thread::hardware_concurrency() << " hardware thread(s))\n"
+              << "   SpscRingQueue x" << OBSERVERS << " fan-out: " << std::setw(8) << f2 << " ms\n"
+              << "   SpmcBroadcastRingQueue:   " << std::setw(8) << b2 << " ms\n"
+              << "   Speedup: " << std::setprecision(2) << f2 / b2 << "×\n";
+    return 0;
+}
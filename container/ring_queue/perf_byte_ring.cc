@@ -0,0 +1,214 @@
+// container/ring_queue/perf_byte_ring.cc
+// Variable-length messages (8 B .. 2 KB, mostly short): a heap vector per
+// message in RingQueue / SpscRingQueue vs records stored inline in
+// ByteRingQueue / SpscByteRingQueue. Reports time and heap allocations
+// per message.
+
+#include "ring_queue.hh"
+#include "spsc_ring_queue.hh"
+#include "byte_ring_queue.hh"
+#include "perf_util.hh"
+#include <new>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <stdexcept>
+
+using Clock = std::chrono::steady_clock;
+using ns    = std::chrono::nanoseconds;
+using Byte  = std::uint8_t;
+using Msg   = std::vector<Byte>;
+
+constexpr std::size_t N     = 5'000'000;       // messages per run
+constexpr std::size_t BURST = 32;              // single thread: push BURST, then drain
+constexpr std::size_t LENS  = 4096;            // length pattern, repeated
+constexpr std::size_t RING  = 64u << 10;       // SPSC ring bytes
+constexpr int RUNS = 3;
+
+// ---------------------------------------------------------------------
+//  Heap allocation counter
+// ---------------------------------------------------------------------
+static std::atomic<std::size_t> g_allocs{0};
+
+void* operator new(std::size_t n)
+{
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// ---------------------------------------------------------------------
+//  Workload: 70 % trace messages (8-64 B), 25 % small packets (64-256 B),
+//  5 % large packets (256 B - 2 KB).
+// ---------------------------------------------------------------------
+std::vector<std::uint16_t> make_lengths()
+{
+    std::mt19937 rng(42);
+    std::vector<std::uint16_t> lens(LENS);
+    for (auto& l : lens) {
+        const unsigned r = rng() % 100;
+        l = std::uint16_t(r < 70 ? 8 + rng() % 57 : r < 95 ? 64 + rng() % 193 : 256 + rng() % 1793);
+    }
+    return lens;
+}
+
+const std::vector<std::uint16_t> kLens = make_lengths();
+const std::vector<Byte> kSource = [] {
+    std::vector<Byte> s(2048);
+    for (std::size_t i = 0; i < s.size(); ++i) s[i] = Byte(i * 7);
+    return s;
+}();
+
+// "Handling" a message: its length and a few payload bytes.
+inline std::uint64_t handle(const Byte* p, std::size_t len)
+{
+    std::uint64_t first, last;
+    std::memcpy(&first, p, 8);
+    std::memcpy(&last, p + len - 8, 8);
+    return len + (first ^ last);
+}
+
+// ---------------------------------------------------------------------
+//  Single thread
+// ---------------------------------------------------------------------
+[[gnu::noinline]] std::uint64_t vector_single()
+{
+    RingQueue<Msg> q;
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < N; i += BURST) {
+        for (std::size_t k = 0; k < BURST; ++k) {
+            const std::size_t len = kLens[(i + k) % LENS];
+            q.emplace(kSource.begin(), kSource.begin() + len);
+        }
+        while (!q.empty()) {
+            sum += handle(q.front().data(), q.front().size());
+            q.pop();
+        }
+    }
+    return sum;
+}
+
+[[gnu::noinline]] std::uint64_t byte_single()
+{
+    ByteRingQueue q;
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < N; i += BURST) {
+        for (std::size_t k = 0; k < BURST; ++k) {
+            const std::size_t len = kLens[(i + k) % LENS];
+            std::memcpy(q.reserve(len), kSource.data(), len);
+            q.commit();
+        }
+        while (!q.empty()) {
+            const auto rec = q.peek();
+            sum += handle(rec.data(), rec.size());
+            q.release();
+        }
+    }
+    return sum;
+}
+
+// ---------------------------------------------------------------------
+//  Producer thread -> consumer thread
+// ---------------------------------------------------------------------
+std::uint64_t vector_threads()
+{
+    SpscRingQueue<Msg> q(RING / 128);          // the same bytes at the mean length
+    std::uint64_t sum = 0;
+    std::thread consumer([&] {
+        for (std::size_t i = 0; i < N; ++i) {
+            Msg* m;
+            while (!(m = q.front())) spin();
+            sum += handle(m->data(), m->size());
+            q.pop();
+        }
+    });
+    for (std::size_t i = 0; i < N; ++i) {
+        const std::size_t len = kLens[i % LENS];
+        Msg m(kSource.begin(), kSource.begin() + len);
+        while (!q.try_push(std::move(m))) spin();
+    }
+    consumer.join();
+    return sum;
+}
+
+std::uint64_t byte_threads()
+{
+    SpscByteRingQueue q(RING);
+    std::uint64_t sum = 0;
+    std::thread consumer([&] {
+        for (std::size_t i = 0; i < N; ++i) {
+            RingSpan<const Byte> rec;
+            while (!(rec = q.peek()).data()) spin();
+            sum += handle(rec.data(), rec.size());
+            q.release();
+        }
+    });
+    for (std::size_t i = 0; i < N; ++i) {
+        const std::size_t len = kLens[i % LENS];
+        Byte* p;
+        while (!(p = q.try_reserve(len))) spin();
+        std::memcpy(p, kSource.data(), len);
+        q.commit(len);
+    }
+    consumer.join();
+    return sum;
+}
+
+// ---------------------------------------------------------------------
+//  Main
+// ---------------------------------------------------------------------
+struct Result { double ms; double allocs_per_msg; std::uint64_t sum; };
+
+template<class F>
+Result measure(F&& f)
+{
+    Result r{ 1e300, 0, 0 };
+    for (int i = 0; i < RUNS; ++i) {
+        const std::size_t a0 = g_allocs.load();
+        const auto start = Clock::now();
+        r.sum = f();
+        r.ms = std::min(r.ms, std::chrono::duration_cast<ns>(Clock::now() - start).count() / 1e6);
+        r.allocs_per_msg = double(g_allocs.load() - a0) / N;
+    }
+    return r;
+}
+
+void report(const char* title, const char* a_name, const Result& a,
+            const char* b_name, const Result& b)
+{
+    if (a.sum != b.sum) throw std::runtime_error("checksums differ");
+    std::cout << title << "\n" << std::fixed
+              << "   " << std::left << std::setw(26) << a_name << std::right << std::setprecision(1)
+              << std::setw(8) << a.ms << " ms  " << std::setw(6) << a.ms * 1e6 / N << " ns/msg  "
+              << std::setprecision(3) << a.allocs_per_msg << " allocs/msg\n"
+              << "   " << std::left << std::setw(26) << b_name << std::right << std::setprecision(1)
+              << std::setw(8) << b.ms << " ms  " << std::setw(6) << b.ms * 1e6 / N << " ns/msg  "
+              << std::setprecision(3) << b.allocs_per_msg << " allocs/msg\n"
+              << "   Speedup: " << std::setprecision(2) << a.ms / b.ms << "×\n\n";
+}
+
+int main()
+{
+    std::size_t bytes = 0;
+    for (auto l : kLens) bytes += l;
+    std::cout << "\n=== Variable-length messages: " << N << " messages, mean "
+              << bytes / LENS << " B ===\n\n";
+
+    report("1. Single thread, bursts of 32",
+           "RingQueue<vector<uint8_t>>", measure(vector_single),
+           "ByteRingQueue", measure(byte_single));
+    report("2. Producer thread -> consumer thread, 64 KB of ring",
+           "SpscRingQueue<vector>", measure(vector_threads),
+           "SpscByteRingQueue", measure(byte_threads));
+    return 0;
+}
@@ -0,0 +1,132 @@
+// container/ring_queue/perf_checkpoint.cc
+// Checkpoint / restore of a 100M-element RingQueue: element by element
+// (the gem5 paramOut-style loop) vs the bulk serialize()/unserialize()
+// through a std::fstream and through a raw file descriptor.
+
+#include "ring_queue.hh"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using Clock   = std::chrono::steady_clock;
+using ns      = std::chrono::nanoseconds;
+using Element = std::uint64_t;
+using Queue   = RingQueue<Element>;
+
+template<class F>
+double time_ms(F&& f)
+{
+    auto start = Clock::now();
+    f();
+    return std::chrono::duration_cast<ns>(Clock::now() - start).count() / 1e6;
+}
+
+std::uint64_t checksum(const Queue& q)
+{
+    std::uint64_t sum = 0, i = 0;
+    const auto [a, b] = q.segments();
+    for (Element v : a) sum += v * ++i;
+    for (Element v : b) sum += v * ++i;
+    return sum;
+}
+
+// ---------------------------------------------------------------------
+//  Baseline: one stream write / read + push per element
+// ---------------------------------------------------------------------
+void save_elementwise(const Queue& q, const std::string& path)
+{
+    std::ofstream os(path, std::ios::binary);
+    const std::uint64_t n = q.size();
+    os.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    for (std::size_t i = 0; i < q.size(); ++i)
+        os.write(reinterpret_cast<const char*>(&q[i]), sizeof(Element));
+    if (!os) throw std::runtime_error("write failed");
+}
+
+void load_elementwise(Queue& q, const std::string& path)
+{
+    std::ifstream is(path, std::ios::binary);
+    std::uint64_t n = 0;
+    is.read(reinterpret_cast<char*>(&n), sizeof(n));
+    q.clear();
+    for (std::uint64_t i = 0; i < n; ++i) {
+        Element v;
+        is.read(reinterpret_cast<char*>(&v), sizeof(v));
+        q.push(v);
+    }
+    if (!is) throw std::runtime_error("read failed");
+}
+
+int main(int argc, char* argv[])
+{
+    const std::size_t n = argc >= 2 ? std::stoull(argv[1]) : 100'000'000;
+    const std::string path = "/tmp/ring_queue_checkpoint.bin";
+
+    // Wrapped queue: head in the middle of the buffer, two runs.
+    Queue q(n);
+    for (std::size_t i = 0; i < q.capacity() - n / 2; ++i) q.push(0);
+    for (std::size_t i = 0; i < q.capacity() - n / 2; ++i) q.pop();
+    for (std::size_t i = 0; i < n; ++i) q.push(Element(i) * 2654435761u);
+    const std::uint64_t expect = checksum(q);
+    const double mib = n * sizeof(Element) / double(1 << 20);
+
+    std::cout << "\n=== RingQueue checkpoint, " << n << " elements ("
+              << std::fixed << std::setprecision(0) << mib << " MiB, "
+              << (q.segments().second.empty() ? "1 run" : "2 runs") << ") ===\n\n"
+              << std::setprecision(1)
+              << "                     save ms   restore ms   save MiB/s   restore MiB/s\n";
+
+    const auto row = [&](const char* name, double save, double load, const Queue& r) {
+        if (checksum(r) != expect || r.size() != n) throw std::runtime_error("restore mismatch");
+        std::cout << "  " << std::left << std::setw(18) << name << std::right
+                  << std::setw(9) << save << std::setw(13) << load
+                  << std::setw(13) << mib / save * 1e3
+                  << std::setw(16) << mib / load * 1e3 << '\n';
+    };
+
+    {
+        Queue r;
+        const double s = time_ms([&] { save_elementwise(q, path); });
+        const double l = time_ms([&] { load_elementwise(r, path); });
+        row("element-wise", s, l, r);
+    }
+    {
+        Queue r;
+        const double s = time_ms([&] {
+            std::ofstream os(path, std::ios::binary);
+            q.serialize(os);
+        });
+        const double l = time_ms([&] {
+            std::ifstream is(path, std::ios::binary);
+            r.unserialize(is);
+        });
+        row("bulk, fstream", s, l, r);
+    }
+    {
+        Queue r;
+        const double s = time_ms([&] {
+            const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0) throw std::runtime_error("open failed");
+            q.serialize(fd);
+            ::close(fd);
+        });
+        const double l = time_ms([&] {
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) throw std::runtime_error("open failed");
+            r.unserialize(fd);
+            ::close(fd);
+        });
+        row("bulk, fd", s, l, r);
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,133 @@
+// container/ring_queue/perf_coro_channel.cc
+// N-stage pipeline (source → N relay stages → sink): coroutine stages on
+// CoroChannel / MtCoroChannel vs one OS thread per stage on
+// BlockingRingQueue. Capacity 1 measures the raw hand-off; capacity 64
+// shows what batched resumption buys.
+
+#include "coro_channel.hh"
+#include "blocking_ring_queue.hh"
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+
+using Clock = std::chrono::steady_clock;
+using ns    = std::chrono::nanoseconds;
+
+constexpr std::uint64_t ITEMS = 100'000;
+
+// Every stage adds 1, so the sink can check that nothing was lost.
+constexpr std::uint64_t expected_sum(std::size_t stages)
+{
+    return ITEMS * (ITEMS - 1) / 2 + ITEMS * stages;
+}
+
+// ---------------------------------------------------------------------
+//  Coroutine pipeline, generic over the channel / scheduler pair
+// ---------------------------------------------------------------------
+template<class Channel>
+CoroTask source(Channel& out)
+{
+    for (std::uint64_t i = 0; i < ITEMS; ++i) co_await out.push(i);
+    out.close();
+}
+
+template<class Channel>
+CoroTask relay(Channel& in, Channel& out)
+{
+    while (std::optional<std::uint64_t> v = co_await in.pop()) co_await out.push(*v + 1);
+    out.close();
+}
+
+template<class Channel>
+CoroTask sink(Channel& in, std::uint64_t& sum)
+{
+    while (std::optional<std::uint64_t> v = co_await in.pop()) sum += *v;
+}
+
+template<class Channel, class Scheduler, class... RunArgs>
+double coro_pipeline_ms(std::size_t stages, std::size_t cap, RunArgs... run_args)
+{
+    Scheduler sched;
+    std::vector<std::unique_ptr<Channel>> ch;
+    for (std::size_t i = 0; i <= stages; ++i) ch.push_back(std::make_unique<Channel>(sched, cap));
+    std::uint64_t sum = 0;
+
+    const auto start = Clock::now();
+    sched.spawn(source(*ch[0]));
+    for (std::size_t i = 0; i < stages; ++i) sched.spawn(relay(*ch[i], *ch[i + 1]));
+    sched.spawn(sink(*ch[stages], sum));
+    sched.run(run_args...);
+    const auto end = Clock::now();
+
+    if (sum != expected_sum(stages)) throw std::runtime_error("coroutine pipeline lost data");
+    return std::chrono::duration_cast<ns>(end - start).count() / 1e6;
+}
+
+// ---------------------------------------------------------------------
+//  Thread-per-stage pipeline on BlockingRingQueue
+// ---------------------------------------------------------------------
+double thread_pipeline_ms(std::size_t stages, std::size_t cap)
+{
+    using Queue = BlockingRingQueue<std::uint64_t>;
+    std::vector<std::unique_ptr<Queue>> q;
+    for (std::size_t i = 0; i <= stages; ++i)           // MPMC rings need cap >= 2
+        q.push_back(std::make_unique<Queue>(std::max<std::size_t>(cap, 2)));
+    std::uint64_t sum = 0;
+
+    const auto start = Clock::now();
+    std::vector<std::thread> threads;
+    threads.emplace_back([&] {
+        for (std::uint64_t i = 0; i < ITEMS; ++i) q[0]->push(i);
+        q[0]->close();
+    });
+    for (std::size_t s = 0; s < stages; ++s) {
+        threads.emplace_back([&, s] {
+            std::uint64_t v;
+            while (q[s]->pop(v)) q[s + 1]->push(v + 1);
+            q[s + 1]->close();
+        });
+    }
+    threads.emplace_back([&] {
+        std::uint64_t v;
+        while (q[stages]->pop(v)) sum += v;
+    });
+    for (auto& t : threads) t.join();
+    const auto end = Clock::now();
+
+    if (sum != expected_sum(stages)) throw std::runtime_error("thread pipeline lost data");
+    return std::chrono::duration_cast<ns>(end - start).count() / 1e6;
+}
+
+// ---------------------------------------------------------------------
+//  Main
+// ---------------------------------------------------------------------
+int main()
+{
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "\n=== Pipeline of N stages, " << ITEMS << " items, "
+              << hw << " hardware thread(s) ===\n"
+              << "    (ns per item per hop; hops = N + 1)\n\n"
+              << "   cap  stages |  CoroChannel  MtCoroChannel(" << hw
+              << ")  thread/stage (BlockingRingQueue)\n";
+
+    for (std::size_t cap : { 1, 64 }) {
+        for (std::size_t stages : { 1, 4, 16, 64 }) {
+            const double hops = double(ITEMS) * double(stages + 1);
+            const double st = coro_pipeline_ms<CoroChannel<std::uint64_t>, CoroScheduler>(stages, cap);
+            const double mt = coro_pipeline_ms<MtCoroChannel<std::uint64_t>, MtCoroScheduler>(stages, cap, hw);
+            const double th = thread_pipeline_ms(stages, cap);
+            std::cout << std::fixed << std::setprecision(1)
+                      << "  " << std::setw(4) << cap << "  " << std::setw(6) << stages << " |"
+                      << std::setw(13) << st * 1e6 / hops
+                      << std::setw(17) << mt * 1e6 / hops
+                      << std::setw(17) << th * 1e6 / hops << '\n';
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+// container/ring_queue/perf_mpmc.cc
+// Scaling benchmark: MpmcRingQueue vs std::mutex + RingQueue, 1..cores
+// producers × 1..cores consumers.
+
+#include "perf_util.hh"
+#include "mpmc_ring_queue.hh"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+
+using Clock = std::chrono::steady_clock;
+using ns    = std::chrono::nanoseconds;
+
+using Element = long;
+
+constexpr std::size_t N        = 10'000'000;   // total transfers per run
+constexpr std::size_t CAPACITY = 4096;
+
+// ---------------------------------------------------------------------
+//  P producers split N pushes, C consumers split N pops
+// ---------------------------------------------------------------------
+template<class Q>
+double run_ms(unsigned producers, unsigned consumers)
+{
+    Q q(CAPACITY);
+    std::atomic<std::size_t> popped{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+
+    for (unsigned c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire)) spin();
+            Element v;
+            while (popped.load(std::memory_order_relaxed) < N) {
+                if (q.try_pop(v)) popped.fetch_add(1, std::memory_order_relaxed);
+                else spin();
+            }
+        });
+    }
+    for (unsigned p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            while (!go.load(std::memory_order_acquire)) spin();
+            const std::size_t begin = N * p / producers;
+            const std::size_t end   = N * (p + 1) / producers;
+            for (std::size_t i = begin; i < end; ++i) {
+                while (!q.try_push(Element(i))) spin();
+            }
+        });
+    }
+
+    auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& t : threads) t.join();
+    auto end = Clock::now();
+
+    return std::chrono::duration_cast<ns>(end - start).count() / 1e6;
+}
+
+// 1, 2, 4, … up to the core count (which is always included).
+std::vector<unsigned> thread_counts()
+{
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> v;
+    for (unsigned n = 1; n < cores; n *= 2) v.push_back(n);
+    v.push_back(cores);
+    return v;
+}
+
+// ---------------------------------------------------------------------
+//  Main
+// ---------------------------------------------------------------------
+int main()
+{
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "=== MpmcRingQueue vs mutex + RingQueue ===\n"
+              << "Element: " << typeid(Element).name()
+              << ", N = " << N << ", capacity = " << CAPACITY
+              << ", hardware threads = " << std::thread::hardware_concurrency() << "\n\n";
+
+    std::cout << "   P   C |   MPMC (ms)   Mops/s |  mutex (ms)   Mops/s | Speedup\n"
+              << "  -------+----------------------+----------------------+--------\n";
+    for (unsigned p : thread_counts()) {
+        for (unsigned c : thread_counts()) {
+            double m = run_ms<MpmcRingQueue<Element>>(p, c);
+            double l = run_ms<LockedRingQueue<Element>>(p, c);
+            std::cout << "  " << std::setw(2) << p << "  " << std::setw(2) << c << " | "
+                      << std::setw(10) << m << " " << std::setw(8) << N / m / 1e3 << " | "
+                      << std::setw(10) << l << " " << std::setw(8) << N / l / 1e3 << " | "
+                      << std::setw(6) << l / m << "×\n";
+        }
+    }
+
+    std::cout << "\nAll benchmarks complete.\n";
+    return 0;
+}
@@ -0,0 +1,181 @@
+// container/ring_queue/perf_shm.cc
+// Two processes, one message stream: a pipe and a UNIX stream socket (one
+// write() per message, as the simulators do today) vs ShmRingQueue in
+// SPSC and MPSC mode. The producer is a forked child; this process
+// consumes and checks every message.
+
+#include "shm_ring_queue.hh"
+#include <chrono>
+#include <string>
+#include <thread>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <stdexcept>
+
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using Clock = std::chrono::steady_clock;
+using ns    = std::chrono::nanoseconds;
+
+constexpr std::uint64_t N   = 1'000'000;       // messages per run
+constexpr std::size_t   CAP = 1024;            // ring slots
+constexpr int RUNS = 3;
+
+struct Msg {                                   // 64 bytes
+    std::uint64_t seq;
+    std::uint64_t payload[7];
+};
+
+inline Msg make_msg(std::uint64_t i)
+{
+    Msg m{ i, {} };
+    for (int k = 0; k < 7; ++k) m.payload[k] = i * (k + 1);
+    return m;
+}
+
+inline bool check(const Msg& m, std::uint64_t expect)
+{
+    return m.seq == expect && m.payload[6] == expect * 7;
+}
+
+// Busy-wait step: on a single hardware thread, hand over the time slice.
+static const bool kYield = std::thread::hardware_concurrency() < 2;
+inline void spin() { if (kYield) ::sched_yield(); }
+
+const std::string kName = "/ring_queue_perf_" + std::to_string(::getpid());
+
+// ---------------------------------------------------------------------
+//  Runs produce() in a forked child and consume() here; milliseconds.
+// ---------------------------------------------------------------------
+template<class Produce, class Consume>
+double two_processes(Produce produce, Consume consume)
+{
+    const auto start = Clock::now();
+    const pid_t pid = ::fork();
+    if (pid < 0) throw std::runtime_error("fork failed");
+    if (pid == 0) {
+        produce();
+        ::_exit(0);
+    }
+    const bool ok = consume();
+    int status = 0;
+    ::waitpid(pid, &status, 0);
+    const double ms = std::chrono::duration_cast<ns>(Clock::now() - start).count() / 1e6;
+    if (!ok || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        throw std::runtime_error("message stream corrupted");
+    return ms;
+}
+
+// ---------------------------------------------------------------------
+//  File descriptors: pipe() or socketpair()
+// ---------------------------------------------------------------------
+double fd_stream(bool socket)
+{
+    int fds[2];
+    if ((socket ? ::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) : ::pipe(fds)) != 0)
+        throw std::runtime_error("pipe / socketpair failed");
+    const double ms = two_processes(
+        [&] {
+            ::close(fds[0]);
+            for (std::uint64_t i = 0; i < N; ++i) {
+                const Msg m = make_msg(i);
+                const char* p = reinterpret_cast<const char*>(&m);
+                for (std::size_t done = 0; done < sizeof m;) {
+                    const ssize_t w = ::write(fds[1], p + done, sizeof m - done);
+                    if (w <= 0) ::_exit(1);
+                    done += std::size_t(w);
+                }
+            }
+            ::close(fds[1]);
+        },
+        [&] {
+            ::close(fds[1]);
+            // Read whatever has arrived; a message may be split across reads.
+            Msg buf[64];
+            std::size_t have = 0;
+            std::uint64_t expect = 0;
+            bool ok = true;
+            while (expect < N) {
+                const ssize_t r = ::read(fds[0], reinterpret_cast<char*>(buf) + have, sizeof buf - have);
+                if (r <= 0) return false;
+                have += std::size_t(r);
+                const std::size_t whole = have / sizeof(Msg);
+                for (std::size_t k = 0; k < whole; ++k) ok = ok && check(buf[k], expect++);
+                have -= whole * sizeof(Msg);
+                std::memmove(buf, reinterpret_cast<char*>(buf) + whole * sizeof(Msg), have);
+            }
+            ::close(fds[0]);
+            return ok;
+        });
+    return ms;
+}
+
+// ---------------------------------------------------------------------
+//  Shared-memory ring: the child opens it by name
+// ---------------------------------------------------------------------
+template<ShmMode Mode>
+double shm_stream()
+{
+    using Q = ShmRingQueue<Msg, Mode>;
+    Q::unlink(kName.c_str());
+    Q q = Q::create(kName.c_str(), CAP);
+    const double ms = two_processes(
+        [&] {
+            Q out = Q::open(kName.c_str());
+            for (std::uint64_t i = 0; i < N; ++i) {
+                const Msg m = make_msg(i);
+                while (!out.try_push(m)) spin();
+            }
+        },
+        [&] {
+            bool ok = true;
+            for (std::uint64_t expect = 0; expect < N;) {
+                Msg m;
+                if (!q.try_pop(m)) { spin(); continue; }
+                ok = ok && check(m, expect++);
+            }
+            return ok;
+        });
+    Q::unlink(kName.c_str());
+    return ms;
+}
+
+// ---------------------------------------------------------------------
+//  Main
+// ---------------------------------------------------------------------
+template<class F>
+double best_ms(F&& f)
+{
+    double best = 1e300;
+    for (int r = 0; r < RUNS; ++r) best = std::min(best, f());
+    return best;
+}
+
+int main()
+{
+    std::cout << "\n=== Two processes, " << N << " messages of " << sizeof(Msg) << " B ("
+              << std::thread::hardware_concurrency() << " hardware thread(s)) ===\n\n"
+              << std::fixed;
+
+    const double pipe_ms   = best_ms([] { return fd_stream(false); });
+    const double socket_ms = best_ms([] { return fd_stream(true); });
+    const double spsc_ms   = best_ms(shm_stream<ShmMode::Spsc>);
+    const double mpsc_ms   = best_ms(shm_stream<ShmMode::Mpsc>);
+
+    auto row = [&](const char* name, double ms) {
+        std::cout << "   " << std::left << std::setw(24) << name << std::right
+                  << std::setprecision(1) << std::setw(8) << ms << " ms  "
+                  << std::setw(7) << ms * 1e6 / N << " ns/msg  "
+                  << std::setprecision(2) << std::setw(6) << pipe_ms / ms << "× vs pipe\n";
+    };
+    row("pipe", pipe_ms);
+    row("UNIX socket", socket_ms);
+    row("ShmRingQueue (SPSC)", spsc_ms);
+    row("ShmRingQueue (MPSC)", mpsc_ms);
+    return 0;
+}
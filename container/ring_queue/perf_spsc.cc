@@ -0,0 +1,127 @@
+// container/ring_queue/perf_spsc.cc
+// Two-thread benchmark: SpscRingQueue vs std::mutex + RingQueue
+
+#include "perf_util.hh"
+#include "spsc_ring_queue.hh"
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+using Clock = std::chrono::steady_clock;
+using ns    = std::chrono::nanoseconds;
+
+using Element = long;
+
+constexpr std::size_t N        = 20'000'000;   // throughput transfers
+constexpr std::size_t PINGS    = 200'000;      // latency round trips
+constexpr std::size_t CAPACITY = 4096;
+
+// ---------------------------------------------------------------------
+//  Throughput: one producer → one consumer
+// ---------------------------------------------------------------------
+template<class Q>
+double throughput_ms()
+{
+    Q q(CAPACITY);
+    Element sink = 0;
+
+    auto start = Clock::now();
+    std::thread consumer([&] {
+        Element v;
+        for (std::size_t i = 0; i < N; ++i) {
+            while (!q.try_pop(v)) { spin(); }
+            sink += v;
+        }
+    });
+    for (std::size_t i = 0; i < N; ++i) {
+        while (!q.try_push(Element(i))) { spin(); }
+    }
+    consumer.join();
+    auto end = Clock::now();
+
+    if (sink != Element(N) * Element(N - 1) / 2) std::cerr << "checksum mismatch\n";
+    return std::chrono::duration_cast<ns>(end - start).count() / 1e6;
+}
+
+// ---------------------------------------------------------------------
+//  Latency: ping-pong over two queues, one-way = RTT / 2
+// ---------------------------------------------------------------------
+struct Latency {
+    double p50_ns;
+    double p99_ns;
+    double mean_ns;
+};
+
+template<class Q>
+Latency pingpong()
+{
+    Q ping(CAPACITY), pong(CAPACITY);
+    std::vector<double> rtt;
+    rtt.reserve(PINGS);
+
+    std::thread echo([&] {
+        Element v;
+        for (std::size_t i = 0; i < PINGS; ++i) {
+            while (!ping.try_pop(v)) { spin(); }
+            while (!pong.try_push(v)) { spin(); }
+        }
+    });
+
+    Element v;
+    for (std::size_t i = 0; i < PINGS; ++i) {
+        auto t0 = Clock::now();
+        while (!ping.try_push(Element(i))) { spin(); }
+        while (!pong.try_pop(v)) { spin(); }
+        auto t1 = Clock::now();
+        rtt.push_back(std::chrono::duration_cast<ns>(t1 - t0).count() / 2.0);
+    }
+    echo.join();
+
+    double sum = 0;
+    for (double t : rtt) sum += t;
+    std::sort(rtt.begin(), rtt.end());
+    return { rtt[rtt.size() / 2], rtt[rtt.size() * 99 / 100], sum / rtt.size() };
+}
+
+// ---------------------------------------------------------------------
+//  Main
+// ---------------------------------------------------------------------
+int main()
+{
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "=== SpscRingQueue vs mutex + RingQueue (2 threads) ===\n"
+              << "Element: " << typeid(Element).name()
+              << ", capacity = " << CAPACITY
+              << ", hardware threads = " << std::thread::hardware_concurrency() << "\n\n";
+
+    // -----------------------------------------------------------------
+    //  Scenario 1: Throughput
+    // -----------------------------------------------------------------
+    {
+        std::cout << "1. Transfer " << N << " elements producer → consumer\n";
+        double s = throughput_ms<SpscRingQueue<Element>>();
+        double m = throughput_ms<LockedRingQueue<Element>>();
+        std::cout << "   SpscRingQueue : " << s << " ms (" << N / s / 1e3 << " Mops/s)\n"
+                  << "   mutex + Ring  : " << m << " ms (" << N / m / 1e3 << " Mops/s)\n"
+                  << "   Speedup       : " << m / s << "×\n\n";
+    }
+
+    // -----------------------------------------------------------------
+    //  Scenario 2: One-way latency
+    // -----------------------------------------------------------------
+    {
+        std::cout << "2. Ping-pong latency (" << PINGS << " round trips, one-way)\n";
+        Latency s = pingpong<SpscRingQueue<Element>>();
+        Latency m = pingpong<LockedRingQueue<Element>>();
+        std::cout << "   SpscRingQueue : p50 " << s.p50_ns << " ns, p99 " << s.p99_ns
+                  << " ns, mean " << s.mean_ns << " ns\n"
+                  << "   mutex + Ring  : p50 " << m.p50_ns << " ns, p99 " << m.p99_ns
+                  << " ns, mean " << m.mean_ns << " ns\n\n";
+    }
+
+    std::cout << "All benchmarks complete.\n";
+    return 0;
+}
@@ -0,0 +1,44 @@
+// container/ring_queue/perf_util.hh
+// Helpers shared by the multi-threaded ring_queue benchmarks.
+#pragma once
+
+#include "ring_queue.hh"
+#include <mutex>
+#include <thread>
+#include <utility>
+
+// Busy-wait step. On a single hardware thread spinning only burns the
+// time slice the other side needs, so hand it over instead.
+inline const bool kYield = std::thread::hardware_concurrency() < 2;
+inline void spin() { if (kYield) std::this_thread::yield(); }
+
+// ---------------------------------------------------------------------
+//  The "before" picture: a RingQueue guarded by a mutex
+// ---------------------------------------------------------------------
+template<class T>
+class LockedRingQueue {
+public:
+    explicit LockedRingQueue(std::size_t cap) : q_(cap), cap_(q_.capacity()) {}
+
+    bool try_push(const T& v)
+    {
+        std::lock_guard<std::mutex> lk(m_);
+        if (q_.size() == cap_) return false;     // keep it bounded
+        q_.push(v);
+        return true;
+    }
+
+    bool try_pop(T& out)
+    {
+        std::lock_guard<std::mutex> lk(m_);
+        if (q_.empty()) return false;
+        out = std::move(q_.front());
+        q_.pop();
+        return true;
+    }
+
+private:
+    std::mutex m_;
+    RingQueue<T> q_;
+    std::size_t cap_;
+};
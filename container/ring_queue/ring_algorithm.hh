@@ -0,0 +1,361 @@
+// container/ring_queue/ring_algorithm.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @file   ring_algorithm.hh
+ * @brief  find / rfind / count over the contents of a ring queue, one
+ *         contiguous segment at a time instead of masking every index.
+ *
+ *  * Work on anything with `segments() const` (RingQueue, StaticRingQueue,
+ *    SmallRingQueue, HistoryQueue, ...) or directly on a segment pair,
+ *    e.g. one column of a SoaRingQueue: `ring_algo::find(q.segments<1>(), key)`.
+ *  * Results are logical indices from the front (`q[i]`), `ring_algo::npos`
+ *    if nothing matches. `rfind*` searches youngest to oldest.
+ *  * `find_if` / `rfind_if` / `count_if` take any predicate.
+ *    `find` / `rfind` / `count(segs, key, proj)` compare `proj(elem) == key`;
+ *    with a 32- or 64-bit integer key and an identity or data-member
+ *    projection they compare a whole vector of elements per step:
+ *    AVX-512 (8 / 16 lanes) or AVX2 (4 / 8 lanes), chosen at compile time
+ *    (-march), plain loads for a packed key and gathers for a member of a
+ *    struct. Anything else, or a build without AVX2, takes the scalar loop.
+ *  * C++17 (gem5 compatible).
+ */
+
+namespace ring_algo {
+
+/// "No match".
+inline constexpr std::size_t npos = ~std::size_t(0);
+
+/// Default projection: the element itself.
+struct identity {
+    template<class U>
+    constexpr U&& operator()(U&& u) const noexcept { return std::forward<U>(u); }
+};
+
+} // namespace ring_algo
+
+namespace ring_queue_detail {
+
+// ----------------------------------------------------------------- //
+//  Keys the vector kernels handle: 32- / 64-bit integers.
+// ----------------------------------------------------------------- //
+template<class K>
+inline constexpr bool is_simd_key_v =
+    std::is_integral_v<K> && !std::is_same_v<K, bool> && (sizeof(K) == 4 || sizeof(K) == 8);
+
+template<class K>
+inline K load_key(const char* p) noexcept { return *reinterpret_cast<const K*>(p); }
+
+// ----------------------------------------------------------------- //
+//  Compares kLanes keys, `stride` bytes apart from `p`, against one key
+//  and returns the matches as a bit mask (bit i = key i). kLanes == 0
+//  when the target has no usable vector unit.
+// ----------------------------------------------------------------- //
+template<class K>
+struct SimdMatcher {
+#if defined(__AVX512F__)
+    static constexpr std::size_t kLanes = 64 / sizeof(K);
+
+    SimdMatcher(std::size_t stride, K key) noexcept : stride_(stride)
+    {
+        const long long s = (long long)stride;
+        if constexpr (sizeof(K) == 8) {
+            key_ = _mm512_set1_epi64((long long)key);
+            idx_ = _mm512_set_epi64(7 * s, 6 * s, 5 * s, 4 * s, 3 * s, 2 * s, s, 0);
+        } else {
+            key_ = _mm512_set1_epi32((int)key);
+            idx_ = _mm512_set_epi32(int(15 * s), int(14 * s), int(13 * s), int(12 * s),
+                                    int(11 * s), int(10 * s), int(9 * s), int(8 * s),
+                                    int(7 * s), int(6 * s), int(5 * s), int(4 * s),
+                                    int(3 * s), int(2 * s), int(s), 0);
+        }
+    }
+
+    unsigned match(const char* p) const noexcept
+    {
+        if constexpr (sizeof(K) == 8) {
+            // The masked gathers take a defined pass-through (key_, unused
+            // with a full mask); GCC 12 warns about the plain ones.
+            const __m512i v = stride_ == 8 ? _mm512_loadu_si512(p)
+                                           : _mm512_mask_i64gather_epi64(key_, 0xFF, idx_, p, 1);
+            return _mm512_cmpeq_epi64_mask(v, key_);
+        } else {
+            const __m512i v = stride_ == 4 ? _mm512_loadu_si512(p)
+                                           : _mm512_mask_i32gather_epi32(key_, 0xFFFF, idx_, p, 1);
+            return _mm512_cmpeq_epi32_mask(v, key_);
+        }
+    }
+
+    std::size_t stride_;
+    __m512i key_, idx_;
+#elif defined(__AVX2__)
+    static constexpr std::size_t kLanes = 32 / sizeof(K);
+
+    SimdMatcher(std::size_t stride, K key) noexcept : stride_(stride)
+    {
+        const long long s = (long long)stride;
+        if constexpr (sizeof(K) == 8) {
+            key_ = _mm256_set1_epi64x((long long)key);
+            idx_ = _mm256_set_epi64x(3 * s, 2 * s, s, 0);
+        } else {
+            key_ = _mm256_set1_epi32((int)key);
+            idx_ = _mm256_set_epi32(int(7 * s), int(6 * s), int(5 * s), int(4 * s),
+                                    int(3 * s), int(2 * s), int(s), 0);
+        }
+    }
+
+    unsigned match(const char* p) const noexcept
+    {
+        if constexpr (sizeof(K) == 8) {
+            const __m256i v = stride_ == 8
+                ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))
+                : _mm256_i64gather_epi64(reinterpret_cast<const long long*>(p), idx_, 1);
+            return unsigned(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v, key_))));
+        } else {
+            const __m256i v = stride_ == 4
+                ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))
+                : _mm256_i32gather_epi32(reinterpret_cast<const int*>(p), idx_, 1);
+            return unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, key_))));
+        }
+    }
+
+    std::size_t stride_;
+    __m256i key_, idx_;
+#else
+    static constexpr std::size_t kLanes = 0;
+
+    SimdMatcher(std::size_t, K) noexcept {}
+    unsigned match(const char*) const noexcept { return 0; }
+#endif
+};
+
+// ----------------------------------------------------------------- //
+//  Kernels over one run of n keys, `stride` bytes apart from `base`.
+//  Whole vectors first (from the front or the back), scalar remainder.
+// ----------------------------------------------------------------- //
+template<class K>
+std::size_t run_find(const char* base, std::size_t stride, std::size_t n, K key) noexcept
+{
+    constexpr std::size_t L = SimdMatcher<K>::kLanes;
+    std::size_t i = 0;
+    if constexpr (L != 0) {
+        const SimdMatcher<K> m(stride, key);
+        for (; i + L <= n; i += L)
+            if (const unsigned bits = m.match(base + i * stride)) return i + __builtin_ctz(bits);
+    }
+    for (; i < n; ++i)
+        if (load_key<K>(base + i * stride) == key) return i;
+    return ring_algo::npos;
+}
+
+template<class K>
+std::size_t run_rfind(const char* base, std::size_t stride, std::size_t n, K key) noexcept
+{
+    constexpr std::size_t L = SimdMatcher<K>::kLanes;
+    std::size_t i = n;
+    if constexpr (L != 0) {
+        const SimdMatcher<K> m(stride, key);
+        for (; i >= L; i -= L)
+            if (const unsigned bits = m.match(base + (i - L) * stride))
+                return i - L + (31 - __builtin_clz(bits));
+    }
+    while (i-- > 0)
+        if (load_key<K>(base + i * stride) == key) return i;
+    return ring_algo::npos;
+}
+
+template<class K>
+std::size_t run_count(const char* base, std::size_t stride, std::size_t n, K key) noexcept
+{
+    constexpr std::size_t L = SimdMatcher<K>::kLanes;
+    std::size_t i = 0, c = 0;
+    if constexpr (L != 0) {
+        const SimdMatcher<K> m(stride, key);
+        for (; i + L <= n; i += L) c += __builtin_popcount(m.match(base + i * stride));
+    }
+    for (; i < n; ++i) c += load_key<K>(base + i * stride) == key;
+    return c;
+}
+
+// ----------------------------------------------------------------- //
+//  Projections the kernels understand: key_type is the key they load
+//  (void if none), first() where element 0's key sits.
+// ----------------------------------------------------------------- //
+template<class T, class Proj>
+struct KeyAccess {
+    using key_type = void;
+};
+
+template<class T>
+struct KeyAccess<T, ring_algo::identity> {
+    using key_type = std::remove_cv_t<T>;
+    static const char* first(const T* p, ring_algo::identity) noexcept
+    {
+        return reinterpret_cast<const char*>(p);
+    }
+};
+
+template<class T, class M, class C>
+struct KeyAccess<T, M C::*> {
+    using key_type = std::conditional_t<std::is_same_v<std::remove_cv_t<T>, C>
+                                        && !std::is_function_v<M>, std::remove_cv_t<M>, void>;
+    static const char* first(const T* p, M C::* proj) noexcept
+    {
+        return reinterpret_cast<const char*>(&(p->*proj));
+    }
+};
+
+// False if no K compares equal to key (usual arithmetic conversions);
+// otherwise K(key) is the one that does.
+template<class K, class Key>
+constexpr bool key_fits(const Key& key) noexcept
+{
+    using C = std::common_type_t<K, Key>;
+    return C(K(key)) == C(key);
+}
+
+template<class T, class Proj, class Key>
+inline constexpr bool use_simd_v = []{
+    using K = typename KeyAccess<T, Proj>::key_type;
+    if constexpr (std::is_void_v<K>) return false;
+    else return is_simd_key_v<K> && std::is_integral_v<Key> && SimdMatcher<K>::kLanes != 0;
+}();
+
+} // namespace ring_queue_detail
+
+namespace ring_algo {
+
+//==========================================================================//
+//  Predicate searches
+//==========================================================================//
+
+/** @brief Index of the oldest element satisfying @p pred, or `npos`. */
+template<class T, class Pred>
+std::size_t find_if(const std::pair<RingSpan<T>, RingSpan<T>>& segs, Pred pred)
+{
+    const auto& [a, b] = segs;
+    for (std::size_t i = 0; i < a.size(); ++i)
+        if (pred(a[i])) return i;
+    for (std::size_t i = 0; i < b.size(); ++i)
+        if (pred(b[i])) return a.size() + i;
+    return npos;
+}
+
+/** @brief Index of the youngest element satisfying @p pred, or `npos`. */
+template<class T, class Pred>
+std::size_t rfind_if(const std::pair<RingSpan<T>, RingSpan<T>>& segs, Pred pred)
+{
+    const auto& [a, b] = segs;
+    for (std::size_t i = b.size(); i-- > 0;)
+        if (pred(b[i])) return a.size() + i;
+    for (std::size_t i = a.size(); i-- > 0;)
+        if (pred(a[i])) return i;
+    return npos;
+}
+
+/** @brief Number of elements satisfying @p pred. */
+template<class T, class Pred>
+std::size_t count_if(const std::pair<RingSpan<T>, RingSpan<T>>& segs, Pred pred)
+{
+    std::size_t c = 0;
+    for (const auto& x : segs.first) c += bool(pred(x));
+    for (const auto& x : segs.second) c += bool(pred(x));
+    return c;
+}
+
+//==========================================================================//
+//  Key searches: proj(elem) == key
+//==========================================================================//
+
+/** @brief Index of the oldest element with `proj(elem) == key`, or `npos`. */
+template<class T, class Key, class Proj = identity>
+std::size_t find(const std::pair<RingSpan<T>, RingSpan<T>>& segs, const Key& key, Proj proj = {})
+{
+    using namespace ring_queue_detail;
+    if constexpr (use_simd_v<T, Proj, Key>) {
+        using K = typename KeyAccess<T, Proj>::key_type;
+        if (!key_fits<K>(key)) return npos;
+        auto run = [&](const RingSpan<T>& s) {
+            return s.empty() ? npos : run_find<K>(KeyAccess<T, Proj>::first(s.data(), proj),
+                                                  sizeof(T), s.size(), K(key));
+        };
+        if (const std::size_t i = run(segs.first); i != npos) return i;
+        if (const std::size_t i = run(segs.second); i != npos) return segs.first.size() + i;
+        return npos;
+    } else {
+        return find_if(segs, [&](const auto& x) { return std::invoke(proj, x) == key; });
+    }
+}
+
+/** @brief Index of the youngest element with `proj(elem) == key`, or `npos`. */
+template<class T, class Key, class Proj = identity>
+std::size_t rfind(const std::pair<RingSpan<T>, RingSpan<T>>& segs, const Key& key, Proj proj = {})
+{
+    using namespace ring_queue_detail;
+    if constexpr (use_simd_v<T, Proj, Key>) {
+        using K = typename KeyAccess<T, Proj>::key_type;
+        if (!key_fits<K>(key)) return npos;
+        auto run = [&](const RingSpan<T>& s) {
+            return s.empty() ? npos : run_rfind<K>(KeyAccess<T, Proj>::first(s.data(), proj),
+                                                   sizeof(T), s.size(), K(key));
+        };
+        if (const std::size_t i = run(segs.second); i != npos) return segs.first.size() + i;
+        return run(segs.first);
+    } else {
+        return rfind_if(segs, [&](const auto& x) { return std::invoke(proj, x) == key; });
+    }
+}
+
+/** @brief Number of elements with `proj(elem) == key`. */
+template<class T, class Key, class Proj = identity>
+std::size_t count(const std::pair<RingSpan<T>, RingSpan<T>>& segs, const Key& key, Proj proj = {})
+{
+    using namespace ring_queue_detail;
+    if constexpr (use_simd_v<T, Proj, Key>) {
+        using K = typename KeyAccess<T, Proj>::key_type;
+        if (!key_fits<K>(key)) return 0;
+        auto run = [&](const RingSpan<T>& s) {
+            return s.empty() ? 0 : run_count<K>(KeyAccess<T, Proj>::first(s.data(), proj),
+                                                sizeof(T), s.size(), K(key));
+        };
+        return run(segs.first) + run(segs.second);
+    } else {
+        return count_if(segs, [&](const auto& x) { return std::invoke(proj, x) == key; });
+    }
+}
+
+//==========================================================================//
+//  Whole-queue forms: anything with segments() const
+//==========================================================================//
+
+template<class Q, class Pred>
+std::size_t find_if(const Q& q, Pred pred) { return find_if(q.segments(), std::move(pred)); }
+
+template<class Q, class Pred>
+std::size_t rfind_if(const Q& q, Pred pred) { return rfind_if(q.segments(), std::move(pred)); }
+
+template<class Q, class Pred>
+std::size_t count_if(const Q& q, Pred pred) { return count_if(q.segments(), std::move(pred)); }
+
+template<class Q, class Key, class Proj = identity>
+std::size_t find(const Q& q, const Key& key, Proj proj = {}) { return find(q.segments(), key, proj); }
+
+template<class Q, class Key, class Proj = identity>
+std::size_t rfind(const Q& q, const Key& key, Proj proj = {}) { return rfind(q.segments(), key, proj); }
+
+template<class Q, class Key, class Proj = identity>
+std::size_t count(const Q& q, const Key& key, Proj proj = {}) { return count(q.segments(), key, proj); }
+
+} // namespace ring_algo
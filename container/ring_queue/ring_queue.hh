@@ -1,24 +1,405 @@
 // container/ring_queue/ring_queue.hh
 #pragma once
 
-#include <vector>
+#include <new>
+#include <memory>
 #include <cassert>
+#include <algorithm>
 #include <utility>
 #include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <iosfwd>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
 #include <type_traits>
 
+#if __has_include(<unistd.h>) && __has_include(<sys/uio.h>)
+#  define RING_QUEUE_POSIX_IO 1
+#  include <cerrno>
+#  include <climits>
+#  include <system_error>
+#  include <sys/uio.h>
+#  include <unistd.h>
+#endif
+
+/*======================================================================
+ *  Shared helpers for the ring_queue family
+ *====================================================================*/
+
+// Lets an empty allocator member take no space (std::allocator, ...).
+#if defined(__has_cpp_attribute)
+#  if __has_cpp_attribute(no_unique_address)
+#    define RING_QUEUE_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#  endif
+#endif
+#ifndef RING_QUEUE_NO_UNIQUE_ADDRESS
+#  define RING_QUEUE_NO_UNIQUE_ADDRESS
+#endif
+namespace ring_queue_detail {
+
+/// Assumed cache-line size, used to keep producer/consumer state apart.
+inline constexpr std::size_t kCacheLine = 64;
+
+// ----------------------------------------------------------------- //
+//  Power-of-two helpers (compile-time safe)
+// ----------------------------------------------------------------- //
+constexpr bool is_power_of_two(std::size_t n) noexcept
+{
+    return n > 0 && (n & (n - 1)) == 0;
+}
+
+inline std::size_t next_power_of_two(std::size_t n) noexcept
+{
+    if (n <= 1) return 1;
+
+#if defined(__GNUC__) || defined(__clang__)
+    return std::size_t(1) << (64 - __builtin_clzll(n - 1));
+#else
+    // Portable fallback (slower, but correct)
+    std::size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+#endif
+}
+
+inline std::size_t reserve_power_of_two(std::size_t n)
+{
+    const std::size_t cap = next_power_of_two(n);
+    assert(is_power_of_two(cap));
+    return cap;
+}
+
+// ----------------------------------------------------------------- //
+//  Bulk-copy helpers
+// ----------------------------------------------------------------- //
+
+/// True if `It` is a raw pointer to T and T can be copied with memcpy.
+template<class T, class It>
+inline constexpr bool is_memcpy_source_v =
+    std::is_trivially_copyable_v<T>
+    && std::is_pointer_v<It>
+    && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, T>;
+
+/// memcpy for trivially copyable runs; tiny runs (the common 1–4 element
+/// burst) are cheaper as fixed-size copies than a variable-length call.
+template<class T>
+inline void copy_run(T* dst, const T* src, std::size_t len) noexcept
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    if (len * sizeof(T) <= 32) {
+        for (std::size_t i = 0; i < len; ++i)
+            std::memcpy(static_cast<void*>(dst + i), src + i, sizeof(T));
+    } else {
+        std::memcpy(static_cast<void*>(dst), src, len * sizeof(T));
+    }
+}
+
+// ----------------------------------------------------------------- //
+//  Checkpoint format: this header, then size() elements as raw bytes,
+//  oldest first.
+// ----------------------------------------------------------------- //
+struct CheckpointHeader {
+    char magic[8];                   ///< kCheckpointMagic
+    std::uint64_t elem_size;         ///< sizeof(T) of the writer
+    std::uint64_t count;             ///< Elements that follow
+    std::uint64_t capacity;          ///< Writer's capacity(), restored as is
+};
+inline constexpr char kCheckpointMagic[8] = { 'R', 'I', 'N', 'G', 'Q', 'C', 'K', '1' };
+
+#if defined(RING_QUEUE_POSIX_IO)
+[[noreturn]] inline void throw_errno(const char* what, int err = errno)
+{
+    throw std::system_error(err, std::generic_category(), what);
+}
+
+/// writev() until every byte of iov[0..n) is out (short writes, EINTR).
+inline void write_fully(int fd, iovec* iov, int n)
+{
+    while (n > 0) {
+        const ssize_t done = ::writev(fd, iov, std::min(n, IOV_MAX));
+        if (done < 0) {
+            if (errno == EINTR) continue;
+            throw_errno("writev");
+        }
+        for (std::size_t left = std::size_t(done); n > 0; ++iov, --n) {
+            if (left < iov->iov_len) {
+                iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+                iov->iov_len -= left;
+                break;
+            }
+            left -= iov->iov_len;
+        }
+    }
+}
+
+/// read() exactly @p bytes; false if the file ends first.
+inline bool read_fully(int fd, void* dst, std::size_t bytes)
+{
+    char* p = static_cast<char*>(dst);
+    while (bytes > 0) {
+        const ssize_t got = ::read(fd, p, std::min<std::size_t>(bytes, SSIZE_MAX));
+        if (got < 0) {
+            if (errno == EINTR) continue;
+            throw_errno("read");
+        }
+        if (got == 0) return false;
+        p += got;
+        bytes -= std::size_t(got);
+    }
+    return true;
+}
+#endif
+
+// ----------------------------------------------------------------- //
+//  Random-access iterator over a power-of-two ring.
+//
+//  Holds the buffer, the mask and an *unmasked* position (head + i), so
+//  arithmetic and comparisons are plain integer ops and only dereference
+//  applies the wrap.
+// ----------------------------------------------------------------- //
+template<class T>
+class RingIterator {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = std::remove_cv_t<T>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+
+    RingIterator() noexcept = default;
+    RingIterator(T* data, std::size_t mask, std::size_t pos) noexcept
+        : data_(data), mask_(mask), pos_(pos) {}
+
+    /// iterator → const_iterator
+    template<class U, class = std::enable_if_t<std::is_same_v<const U, T>>>
+    RingIterator(const RingIterator<U>& o) noexcept
+        : data_(o.data_), mask_(o.mask_), pos_(o.pos_) {}
+
+    reference operator*() const noexcept { return data_[pos_ & mask_]; }
+    pointer operator->() const noexcept { return data_ + (pos_ & mask_); }
+    reference operator[](difference_type n) const noexcept { return data_[(pos_ + n) & mask_]; }
+
+    RingIterator& operator++() noexcept { ++pos_; return *this; }
+    RingIterator& operator--() noexcept { --pos_; return *this; }
+    RingIterator operator++(int) noexcept { RingIterator t = *this; ++pos_; return t; }
+    RingIterator operator--(int) noexcept { RingIterator t = *this; --pos_; return t; }
+    RingIterator& operator+=(difference_type n) noexcept { pos_ += n; return *this; }
+    RingIterator& operator-=(difference_type n) noexcept { pos_ -= n; return *this; }
+
+    friend RingIterator operator+(RingIterator it, difference_type n) noexcept { return it += n; }
+    friend RingIterator operator+(difference_type n, RingIterator it) noexcept { return it += n; }
+    friend RingIterator operator-(RingIterator it, difference_type n) noexcept { return it -= n; }
+    friend difference_type operator-(const RingIterator& a, const RingIterator& b) noexcept
+    {
+        return difference_type(a.pos_ - b.pos_);
+    }
+
+    friend bool operator==(const RingIterator& a, const RingIterator& b) noexcept { return a.pos_ == b.pos_; }
+    friend bool operator!=(const RingIterator& a, const RingIterator& b) noexcept { return a.pos_ != b.pos_; }
+    friend bool operator<(const RingIterator& a, const RingIterator& b) noexcept { return (a - b) < 0; }
+    friend bool operator>(const RingIterator& a, const RingIterator& b) noexcept { return b < a; }
+    friend bool operator<=(const RingIterator& a, const RingIterator& b) noexcept { return !(b < a); }
+    friend bool operator>=(const RingIterator& a, const RingIterator& b) noexcept { return !(a < b); }
+
+  private:
+    template<class> friend class RingIterator;
+
+    T* data_ = nullptr;
+    std::size_t mask_ = 0;
+    std::size_t pos_ = 0;
+};
+
+} // namespace ring_queue_detail
+
+/**
+ * @brief Non-owning view of one contiguous run of ring slots.
+ *
+ * Returned in pairs by `segments()`: the first span starts at the head,
+ * the second holds the wrapped part (possibly empty).
+ */
+template<class T>
+struct RingSpan {
+    T* ptr = nullptr;
+    std::size_t len = 0;
+
+    T* data() const noexcept { return ptr; }
+    std::size_t size() const noexcept { return len; }
+    bool empty() const noexcept { return len == 0; }
+    T* begin() const noexcept { return ptr; }
+    T* end() const noexcept { return ptr + len; }
+    T& operator[](std::size_t i) const noexcept { return ptr[i]; }
+};
+
+/**
+ * @brief Growth / shrink policy for RingQueue.
+ *
+ * @tparam GrowFactor     Capacity multiplier when a push finds the queue
+ *                        full (power-of-two, >= 2).
+ * @tparam GrowStep       Minimum number of slots added per growth; lets a
+ *                        small queue jump straight to a useful size.
+ * @tparam MinCapacity    Floor for the initial capacity and for automatic
+ *                        shrinking.
+ * @tparam ShrinkDivisor  0 = never shrink automatically (default). Otherwise
+ *                        a pop that leaves the queue less than
+ *                        1/ShrinkDivisor full shrinks it to the smallest
+ *                        power-of-two at least twice the size. Growth
+ *                        happens at 100 %, so occupancy has to travel
+ *                        between the two thresholds before the buffer is
+ *                        resized again – no thrashing. Must be >= 4.
+ *
+ * Capacities stay powers of two; growth results are rounded up.
+ */
+template<std::size_t GrowFactor = 2, std::size_t GrowStep = 0,
+         std::size_t MinCapacity = 1, std::size_t ShrinkDivisor = 0>
+struct RingGrowthPolicy {
+    static_assert(ring_queue_detail::is_power_of_two(GrowFactor) && GrowFactor >= 2,
+                  "GrowFactor must be a power-of-two >= 2");
+    static_assert(ring_queue_detail::is_power_of_two(MinCapacity),
+                  "MinCapacity must be a power-of-two");
+    static_assert(ShrinkDivisor == 0 || ShrinkDivisor >= 4,
+                  "ShrinkDivisor must be 0 (off) or >= 4 for hysteresis");
+
+    static constexpr std::size_t kMinCapacity = MinCapacity;
+    static constexpr bool kAutoShrink = ShrinkDivisor != 0;
+
+    /// Capacity to grow to when all @p cap slots are in use.
+    static std::size_t grow(std::size_t cap) noexcept
+    {
+        const std::size_t want = std::max({ cap * GrowFactor, cap + GrowStep, kMinCapacity });
+        return ring_queue_detail::next_power_of_two(want);
+    }
+
+    /// True if @p size elements in @p cap slots is sparse enough to shrink.
+    static bool should_shrink(std::size_t size, std::size_t cap) noexcept
+    {
+        return cap > kMinCapacity && size * ShrinkDivisor < cap;
+    }
+
+    /// Capacity to shrink to: occupancy lands at (1/4, 1/2].
+    static std::size_t shrink(std::size_t size) noexcept
+    {
+        return std::max(ring_queue_detail::next_power_of_two(2 * size), kMinCapacity);
+    }
+};
+
+/*======================================================================
+ *  Instrumentation policies
+ *
+ *  RingQueue reports pushes and resizes to its `Stats` policy. The
+ *  default, RingStatsOff, is an empty type whose hooks do nothing, so it
+ *  takes no space and no time. Pick RingStatsOn per queue, or use the
+ *  CountingRingQueue alias. The default is never chosen by a macro: a
+ *  flag that differs between translation units would make `RingQueue<T>`
+ *  name different types in each of them.
+ *====================================================================*/
+
+/** @brief Snapshot of a queue's counters (all zero when stats are off). */
+struct RingQueueStats {
+    std::size_t high_water  = 0;    ///< Largest size() ever reached
+    std::size_t grow_count  = 0;    ///< Buffer enlargements
+    std::size_t shrink_count = 0;   ///< Buffer reductions
+    std::size_t bytes_moved = 0;    ///< Element bytes copied by resizes
+    std::size_t pushes      = 0;    ///< Elements pushed (either end, bulk)
+    /// occupancy[k] = pushes that left size() in [2^k, 2^(k+1)).
+    std::size_t occupancy[64] = {};
+
+    /** @brief Writes the counters and non-empty histogram buckets to @p os. */
+    template<class Stream>
+    Stream& print(Stream& os) const
+    {
+        os << "high water " << high_water << ", grows " << grow_count
+           << ", shrinks " << shrink_count << ", bytes moved " << bytes_moved
+           << ", pushes " << pushes << "\n";
+        for (std::size_t k = 0; k < 64; ++k) {
+            if (occupancy[k])
+                os << "  size [" << (std::size_t(1) << k) << ", "
+                   << (std::size_t(2) << k) << "): " << occupancy[k] << "\n";
+        }
+        return os;
+    }
+};
+
+/** @brief Disabled instrumentation: every hook is an empty inline call. */
+struct RingStatsOff {
+    static constexpr bool kEnabled = false;
+    void on_push(std::size_t, std::size_t) noexcept {}
+    void on_resize(std::size_t, std::size_t, std::size_t) noexcept {}
+    RingQueueStats snapshot() const noexcept { return {}; }
+    void reset() noexcept {}
+};
+
+/** @brief Enabled instrumentation: keeps a RingQueueStats up to date. */
+struct RingStatsOn {
+    static constexpr bool kEnabled = true;
+
+    /// @p n elements were pushed, leaving @p size elements.
+    void on_push(std::size_t size, std::size_t n) noexcept
+    {
+        s_.pushes += n;
+        s_.high_water = std::max(s_.high_water, size);
+#if defined(__GNUC__) || defined(__clang__)
+        s_.occupancy[63 - __builtin_clzll(size)] += n;        // size >= 1 here
+#else
+        std::size_t k = 0;
+        while (size >>= 1) ++k;
+        s_.occupancy[k] += n;
+#endif
+    }
+
+    /// The buffer went from @p old_cap to @p new_cap slots, copying @p bytes.
+    void on_resize(std::size_t old_cap, std::size_t new_cap, std::size_t bytes) noexcept
+    {
+        ++(new_cap > old_cap ? s_.grow_count : s_.shrink_count);
+        s_.bytes_moved += bytes;
+    }
+
+    RingQueueStats snapshot() const noexcept { return s_; }
+    void reset() noexcept { s_ = {}; }
+
+private:
+    RingQueueStats s_;
+};
+
 /**
  * @file   ring_queue.hh
- * @brief  Dynamic ring queue backed by std::vector.
+ * @brief  Dynamic ring queue backed by raw allocator storage.
  *
  *  * Power-of-two capacity → wrap-around is a cheap `& (cap-1)`.
- *  * Automatic doubling growth.
+ *  * Only live slots hold constructed objects – growth never
+ *    default-constructs the new buffer.
+ *  * Automatic growth (doubling by default) and optional automatic shrink
+ *    with hysteresis, both set by `Growth` (see RingGrowthPolicy).
+ *    Trivially copyable elements are relocated as bytes: the buffer is
+ *    `realloc`ed and unwrapped with one memcpy.
  *  * Strong exception guarantee on push/emplace.
+ *  * Optional counters (high-water mark, resizes, bytes moved, occupancy
+ *    histogram) through `Stats`; free when disabled (the default).
+ *  * Storage comes from `Alloc` (any standard allocator, including
+ *    `std::pmr::polymorphic_allocator<T>`). The allocator supplies the
+ *    buffer only; elements are constructed in place.
  *  * C++17 (gem5 compatible).
  */
-template<class T>
+template<class T, class Alloc = std::allocator<T>, class Growth = RingGrowthPolicy<>,
+         class Stats = RingStatsOff>
 class RingQueue {
+    using AllocTraits = std::allocator_traits<Alloc>;
+    static_assert(std::is_same_v<typename AllocTraits::value_type, T>,
+                  "RingQueue allocator must allocate T");
+    static_assert(std::is_same_v<typename AllocTraits::pointer, T*>,
+                  "RingQueue does not support fancy pointers");
+
   public:
+    using value_type      = T;
+    using allocator_type  = Alloc;
+    using size_type       = std::size_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using iterator        = ring_queue_detail::RingIterator<T>;
+    using const_iterator  = ring_queue_detail::RingIterator<const T>;
+
     //==========================================================================//
     //  Construction
     //==========================================================================//
@@ -29,17 +410,149 @@ class RingQueue {
      * The supplied capacity is **rounded up** to the next power-of-two so that
      * wrap-around can be performed with a cheap bitwise-AND (`& (capacity()-1)`).
      *
-     * @param init_cap  Desired minimum capacity (default = 16). Must be greater than 0.
+     * @param init_cap  Desired minimum capacity (default = 16). Must be greater
+     *                  than 0. Raised to `Growth::kMinCapacity` if smaller.
+     * @param alloc     Allocator for the buffer (e.g. a `memory_resource*`
+     *                  for a pmr queue).
      *
      * @post `capacity()` is a power-of-two and `size() == 0`.
      */
-    explicit RingQueue(std::size_t init_cap = 16)
-        : data_(reserve_power_of_two(init_cap))
-        , cap_mask_(data_.size() - 1)
+    explicit RingQueue(std::size_t init_cap = 16, const Alloc& alloc = Alloc())
+        : alloc_(alloc)
+        , cap_mask_(ring_queue_detail::reserve_power_of_two(
+              std::max(init_cap, Growth::kMinCapacity)) - 1)
     {
         assert(init_cap > 0 && "initial capacity must be >0");
+        data_ = allocate(capacity());
     }
 
+    /**
+     * @brief Copy-constructs a queue holding copies of @p other's elements.
+     *
+     * The copy has the same capacity; its elements start at slot 0. The
+     * allocator is chosen by `select_on_container_copy_construction`.
+     */
+    RingQueue(const RingQueue& other)
+        : RingQueue(other, AllocTraits::select_on_container_copy_construction(other.alloc_))
+    {}
+
+    /** @brief Allocator-extended copy constructor. */
+    RingQueue(const RingQueue& other, const Alloc& alloc)
+        : alloc_(alloc)
+        , cap_mask_(other.cap_mask_)
+    {
+        if (other.cap_mask_ == kNoStorage) return;   // moved-from: no storage either
+        data_ = allocate(capacity());
+        std::size_t i = 0;
+        try {
+            for (; i < other.count_; ++i) new (data_ + i) T(other[i]);
+        } catch (...) {
+            destroy_prefix(data_, i);
+            deallocate(data_, capacity());
+            throw;
+        }
+        count_ = other.count_;
+        tail_  = count_ & cap_mask_;
+    }
+
+    /** @brief Steals @p other's buffer; @p other is left with no storage. */
+    RingQueue(RingQueue&& other) noexcept
+        : alloc_(std::move(other.alloc_))
+        , stats_(std::exchange(other.stats_, Stats()))
+        , data_(std::exchange(other.data_, nullptr))
+        , head_(std::exchange(other.head_, 0))
+        , tail_(std::exchange(other.tail_, 0))
+        , count_(std::exchange(other.count_, 0))
+        , cap_mask_(std::exchange(other.cap_mask_, kNoStorage))
+    {}
+
+    /**
+     * @brief Copy assignment (copy-and-swap).
+     *
+     * The result uses @p other's allocator only if the allocator propagates
+     * on copy assignment; otherwise it keeps its own.
+     */
+    RingQueue& operator=(const RingQueue& other)
+    {
+        if (this != &other) {
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+                RingQueue tmp(other, other.alloc_);
+                swap_all(tmp);
+            } else {
+                RingQueue tmp(other, alloc_);
+                swap_storage(tmp);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment.
+     *
+     * Steals @p other's buffer when the allocators allow it (propagating or
+     * equal); otherwise the elements are moved one by one into storage from
+     * this queue's allocator.
+     */
+    RingQueue& operator=(RingQueue&& other)
+        noexcept(AllocTraits::propagate_on_container_move_assignment::value
+                 || AllocTraits::is_always_equal::value)
+    {
+        if (this == &other) return *this;
+        if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+            RingQueue tmp(std::move(other));
+            swap_all(tmp);
+        } else if constexpr (AllocTraits::is_always_equal::value) {
+            RingQueue tmp(std::move(other));
+            swap_storage(tmp);
+        } else if (alloc_ == other.alloc_) {
+            RingQueue tmp(std::move(other));           // tmp's allocator == ours
+            swap_storage(tmp);
+        } else {
+            RingQueue tmp(other.capacity() ? other.capacity() : 1, alloc_);
+            for (std::size_t i = 0; i < other.count_; ++i) tmp.push(std::move(other[i]));
+            other.clear();
+            swap_storage(tmp);
+        }
+        return *this;
+    }
+
+    ~RingQueue()
+    {
+        clear();
+        deallocate(data_, capacity());
+    }
+
+    /**
+     * @brief Exchanges contents with @p other.
+     *
+     * Allocators are swapped only if they propagate on swap; otherwise they
+     * must compare equal.
+     */
+    void swap(RingQueue& other) noexcept
+    {
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        } else {
+            assert(alloc_ == other.alloc_ && "swap() with unequal allocators");
+        }
+        swap_storage(other);
+    }
+
+    /** @brief Copy of the allocator used for the buffer. */
+    allocator_type get_allocator() const noexcept { return alloc_; }
+
+    /**
+     * @brief Counters collected by the `Stats` policy (all zero if off).
+     *
+     * Counters describe this object: copies start from zero, a moved-from
+     * queue hands them to the new one, and assignment / swap keep them.
+     */
+    RingQueueStats stats() const noexcept { return stats_.snapshot(); }
+
+    /** @brief Zeroes the counters. */
+    void reset_stats() noexcept { stats_.reset(); }
+
     //==========================================================================//
     //  Core API
     //==========================================================================//
@@ -63,7 +576,7 @@ class RingQueue {
     void push(U&& val)
     {
         ensure_capacity();
-        new (data_.data() + tail_) T(std::forward<U>(val));
+        new (data_ + tail_) T(std::forward<U>(val));
         advance_tail();
     }
 
@@ -87,7 +600,7 @@ class RingQueue {
     T& emplace(Args&&... args)
     {
         ensure_capacity();
-        new (data_.data() + tail_) T(std::forward<Args>(args)...);
+        new (data_ + tail_) T(std::forward<Args>(args)...);
         T& r = data_[tail_];
         advance_tail();
         return r;
@@ -147,6 +660,26 @@ class RingQueue {
         return data_[last];
     }
 
+    /**
+     * @brief Accesses the i-th element counted from the front.
+     *
+     * `q[0]` is `front()`, `q[size()-1]` is `back()`.
+     *
+     * @pre `i < size()`.
+     */
+    T& operator[](std::size_t i)
+    {
+        assert(i < count_ && "operator[] out of range");
+        return data_[(head_ + i) & cap_mask_];
+    }
+
+    /** @brief Read-only variant of operator[]. */
+    const T& operator[](std::size_t i) const
+    {
+        assert(i < count_ && "operator[] out of range");
+        return data_[(head_ + i) & cap_mask_];
+    }
+
     /**
      * @brief Removes the front element.
      *
@@ -160,6 +693,253 @@ class RingQueue {
         assert(!empty() && "pop() on empty queue");
         data_[head_].~T();
         advance_head();
+        maybe_shrink();
+    }
+
+    //==========================================================================//
+    //  Double-ended API
+    //==========================================================================//
+
+    /**
+     * @brief Pushes a value to the *front* of the queue (it becomes the
+     *        oldest element).
+     *
+     * Grows like push(). Strong exception guarantee.
+     */
+    template<class U>
+    void push_front(U&& val)
+    {
+        emplace_front(std::forward<U>(val));
+    }
+
+    /**
+     * @brief Constructs an object in-place at the front of the queue.
+     *
+     * @return Reference to the newly constructed element.
+     */
+    template<class... Args>
+    T& emplace_front(Args&&... args)
+    {
+        ensure_capacity();
+        const std::size_t slot = (head_ - 1) & cap_mask_;
+        T* p = new (data_ + slot) T(std::forward<Args>(args)...);
+        head_ = slot;
+        ++count_;
+        stats_.on_push(count_, 1);
+        return *p;
+    }
+
+    /**
+     * @brief Removes the back (youngest) element.
+     *
+     * @pre `!empty()`.
+     */
+    void pop_back()
+    {
+        assert(!empty() && "pop_back() on empty queue");
+        tail_ = (tail_ - 1) & cap_mask_;
+        data_[tail_].~T();
+        --count_;
+        maybe_shrink();
+    }
+
+    /**
+     * @brief Removes the @p n youngest elements (squash).
+     *
+     * For trivially destructible `T` this is a single index update; other
+     * types are destroyed run by run.
+     *
+     * @pre `n <= size()`.
+     */
+    void truncate_back(std::size_t n)
+    {
+        assert(n <= count_ && "truncate_back() beyond size()");
+        const std::size_t new_tail = (tail_ - n) & cap_mask_;
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for_each_run(new_tail, n, [](T* run, std::size_t len) { destroy_prefix(run, len); });
+        }
+        tail_ = new_tail;
+        count_ -= n;
+        maybe_shrink();
+    }
+
+    /**
+     * @brief Removes the @p n oldest elements without reading them.
+     *
+     * For trivially destructible `T` this is a single index update; other
+     * types are destroyed run by run.
+     *
+     * @pre `n <= size()`.
+     */
+    void truncate_front(std::size_t n)
+    {
+        assert(n <= count_ && "truncate_front() beyond size()");
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for_each_run(head_, n, [](T* run, std::size_t len) { destroy_prefix(run, len); });
+        }
+        head_ = (head_ + n) & cap_mask_;
+        count_ -= n;
+        maybe_shrink();
+    }
+
+    //==========================================================================//
+    //  Bulk API
+    //==========================================================================//
+
+    /**
+     * @brief Appends the range `[first, last)` to the back of the queue.
+     *
+     * For forward iterators the buffer is grown at most once and the
+     * elements are written as (at most) two contiguous runs. When `T` is
+     * trivially copyable and the range is given as `T*` / `const T*`,
+     * each run is a single `memcpy`.
+     *
+     * @return Number of elements appended.
+     *
+     * @note Strong exception guarantee (forward iterators): if an element
+     *       constructor throws, the queue contents are unchanged.
+     */
+    template<class InputIt>
+    std::size_t push_n(InputIt first, InputIt last)
+    {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (!std::is_base_of_v<std::forward_iterator_tag, Category>) {
+            std::size_t n = 0;
+            for (; first != last; ++first, ++n) push(*first);
+            return n;
+        } else {
+            const std::size_t n = std::distance(first, last);
+            reserve(count_ + n);
+
+            std::size_t done = 0;
+            try {
+                for_each_run(tail_, n, [&](T* run, std::size_t len) {
+                    if constexpr (ring_queue_detail::is_memcpy_source_v<T, InputIt>) {
+                        ring_queue_detail::copy_run(run, &*first, len);
+                        first += len;
+                        done += len;
+                    } else {
+                        for (std::size_t i = 0; i < len; ++i, ++first, ++done)
+                            new (run + i) T(*first);
+                    }
+                });
+            } catch (...) {
+                for (std::size_t i = 0; i < done; ++i) data_[(tail_ + i) & cap_mask_].~T();
+                throw;
+            }
+            tail_ = (tail_ + n) & cap_mask_;
+            count_ += n;
+            if (n) stats_.on_push(count_, n);
+            return n;
+        }
+    }
+
+    /**
+     * @brief Moves up to @p n elements from the front into @p out.
+     *
+     * Elements are move-assigned through `*out++` and then destroyed. When
+     * `T` is trivially copyable and @p out is a `T*`, each contiguous run is
+     * a single `memcpy`.
+     *
+     * If an assignment through @p out throws, the elements already handed
+     * over stay popped and the rest stay queued.
+     *
+     * @return Number of elements popped (`min(n, size())`).
+     */
+    template<class OutputIt>
+    std::size_t pop_n(OutputIt out, std::size_t n)
+    {
+        n = std::min(n, count_);
+        if constexpr (std::is_trivially_copyable_v<T> && std::is_same_v<OutputIt, T*>) {
+            for_each_run(head_, n, [&](T* run, std::size_t len) {
+                ring_queue_detail::copy_run(out, run, len);
+                out += len;
+            });
+            head_ = (head_ + n) & cap_mask_;
+            count_ -= n;
+        } else {
+            // Pop one element at a time so a throwing `*out =` leaves the
+            // queue consistent.
+            for_each_run(head_, n, [&](T* run, std::size_t len) {
+                for (std::size_t i = 0; i < len; ++i, ++out) {
+                    *out = std::move(run[i]);
+                    run[i].~T();
+                    head_ = (head_ + 1) & cap_mask_;
+                    --count_;
+                }
+            });
+        }
+        maybe_shrink();
+        return n;
+    }
+
+    /**
+     * @brief Hands every element to @p f as contiguous runs, then empties
+     *        the queue.
+     *
+     * @p f is called as `f(T* first, std::size_t len)` at most twice, in
+     * FIFO order: once for `[head, end-of-buffer)` and once for the wrapped
+     * part, if any. Elements may be moved from inside @p f; they are
+     * destroyed afterwards.
+     *
+     * @return Number of elements drained.
+     */
+    template<class F>
+    std::size_t drain(F&& f)
+    {
+        const std::size_t n = count_;
+        for_each_run(head_, n, [&](T* run, std::size_t len) { f(run, len); });
+        clear();
+        return n;
+    }
+
+    /**
+     * @brief Destroys all elements; capacity is unchanged.
+     *
+     * @post `empty()`.
+     */
+    void clear() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (; count_ > 0; advance_head()) data_[head_].~T();
+        }
+        head_ = tail_ = count_ = 0;
+    }
+
+    //==========================================================================//
+    //  Iteration
+    //==========================================================================//
+
+    /**
+     * @brief Random-access iterators in FIFO order (front → back).
+     *
+     * Invalidated by any operation that grows, shrinks or pops.
+     */
+    iterator begin() noexcept { return { data_, cap_mask_, head_ }; }
+    iterator end() noexcept { return { data_, cap_mask_, head_ + count_ }; }
+    const_iterator begin() const noexcept { return { data_, cap_mask_, head_ }; }
+    const_iterator end() const noexcept { return { data_, cap_mask_, head_ + count_ }; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /**
+     * @brief The live elements as (at most) two contiguous spans.
+     *
+     * `first` runs from the head towards the end of the buffer; `second`
+     * holds the wrapped part and is empty when the contents do not wrap.
+     * Loops over the spans see raw memory with no per-element masking.
+     */
+    std::pair<RingSpan<T>, RingSpan<T>> segments() noexcept
+    {
+        const std::size_t first_len = std::min(count_, capacity() - head_);
+        return { { data_ + head_, first_len }, { data_, count_ - first_len } };
+    }
+
+    /** @brief Read-only variant of segments(). */
+    std::pair<RingSpan<const T>, RingSpan<const T>> segments() const noexcept
+    {
+        const std::size_t first_len = std::min(count_, capacity() - head_);
+        return { { data_ + head_, first_len }, { data_, count_ - first_len } };
     }
 
     //==========================================================================//
@@ -194,7 +974,7 @@ class RingQueue {
      *
      * @return Number of slots available before a grow is required.
      */
-    [[nodiscard]] std::size_t capacity() const noexcept { return data_.size(); }
+    [[nodiscard]] std::size_t capacity() const noexcept { return cap_mask_ + 1; }
 
     /**
      * @brief Ensures that at least *n* slots are available.
@@ -208,39 +988,215 @@ class RingQueue {
      */
     void reserve(std::size_t n)
     {
-        if (n > capacity()) grow_to(next_power_of_two(n));
+        if (n > capacity()) grow_to(ring_queue_detail::next_power_of_two(n));
     }
 
     /**
      * @brief Reduces memory usage when the queue is sparsely populated.
      *
-     * * If the queue is empty – the underlying vector is cleared.
-     * * Otherwise, if `size() < capacity()/4` and `capacity() > 16`,
-     *   the buffer is shrunk to `max(size()*2, 16)` (still a power-of-two).
+     * * If the queue is empty – the buffer is released (capacity 0).
+     * * Otherwise, if `size() < capacity()/4`, the buffer is shrunk to the
+     *   smallest power-of-two holding `size()`, but never below
+     *   `max(16, Growth::kMinCapacity)`.
      *
-     * The operation is optional and rarely needed in tight loops.
+     * The operation is optional and rarely needed in tight loops. For a
+     * queue that should give memory back on its own, use a Growth policy
+     * with a ShrinkDivisor instead.
      */
     void shrink_to_fit()
     {
         if (count_ == 0) {
-            data_.clear();
-            data_.shrink_to_fit();
+            deallocate(data_, capacity());
+            data_ = nullptr;
+            cap_mask_ = kNoStorage;
             reset_indices();
-        } else if (count_ < capacity() / 4 && capacity() > 16) {
-            grow_to(std::max(next_power_of_two(count_), std::size_t(16)));
+        } else {
+            const std::size_t floor = std::max(std::size_t(16), Growth::kMinCapacity);
+            if (count_ < capacity() / 4 && capacity() > floor)
+                grow_to(std::max(ring_queue_detail::next_power_of_two(count_), floor));
         }
     }
 
+    //==========================================================================//
+    //  Checkpoint / restore (trivially copyable T)
+    //
+    //  Format: a 32-byte header (magic, sizeof(T), size(), capacity()),
+    //  then the elements oldest → newest as raw bytes. Saving writes the
+    //  (at most) two runs of segments() as they are; restoring allocates
+    //  the buffer once and reads the elements straight into it, starting
+    //  at slot 0. The format is native-endian: restore on the same ABI.
+    //
+    //  The stream overloads are templates, like RingQueueStats::print, so
+    //  this header needs only <iosfwd>; the caller includes the stream.
+    //==========================================================================//
+
+    /**
+     * @brief Writes a checkpoint of the queue to @p os (a std::ostream).
+     *
+     * @throws std::runtime_error if the stream fails (or whatever the
+     *         stream's exception mask throws).
+     */
+    template<class OStream, class = std::enable_if_t<!std::is_integral_v<OStream>>>
+    void serialize(OStream& os) const
+    {
+        const ring_queue_detail::CheckpointHeader hdr = checkpoint_header();
+        const auto [a, b] = segments();
+        os.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+        os.write(reinterpret_cast<const char*>(a.data()), std::ptrdiff_t(a.size() * sizeof(T)));
+        os.write(reinterpret_cast<const char*>(b.data()), std::ptrdiff_t(b.size() * sizeof(T)));
+        if (!os) throw std::runtime_error("RingQueue::serialize: write failed");
+    }
+
+    /**
+     * @brief Replaces the contents with a checkpoint read from @p is (a
+     *        std::istream).
+     *
+     * The capacity is restored too (raised to the policy's minimum).
+     *
+     * @throws std::runtime_error on a malformed or truncated checkpoint,
+     *         std::bad_alloc if the buffer cannot be allocated. The queue
+     *         is unchanged when anything throws.
+     */
+    template<class IStream, class = std::enable_if_t<!std::is_integral_v<IStream>>>
+    void unserialize(IStream& is)
+    {
+        ring_queue_detail::CheckpointHeader hdr;
+        if (!is.read(reinterpret_cast<char*>(&hdr), sizeof(hdr)))
+            throw std::runtime_error("RingQueue::unserialize: truncated header");
+        restore(hdr, [&](T* dst, std::size_t bytes) {
+            is.read(reinterpret_cast<char*>(dst), std::ptrdiff_t(bytes));
+            return std::size_t(is.gcount()) == bytes;
+        });
+    }
+
+#if defined(RING_QUEUE_POSIX_IO)
+    /**
+     * @brief Writes a checkpoint to file descriptor @p fd with one `writev`
+     *        (header + both runs), retried only on short writes.
+     *
+     * @throws std::system_error if writing fails.
+     */
+    void serialize(int fd) const
+    {
+        ring_queue_detail::CheckpointHeader hdr = checkpoint_header();
+        const auto [a, b] = segments();
+        iovec iov[3] = {
+            { &hdr, sizeof(hdr) },
+            { const_cast<T*>(a.data()), a.size() * sizeof(T) },
+            { const_cast<T*>(b.data()), b.size() * sizeof(T) },
+        };
+        ring_queue_detail::write_fully(fd, iov, 3);
+    }
+
+    /**
+     * @brief Replaces the contents with a checkpoint read from @p fd.
+     *
+     * The elements are read directly into the new buffer – no staging
+     * copy, and no per-element work.
+     *
+     * @throws std::system_error if reading fails, otherwise as the
+     *         stream overload.
+     */
+    void unserialize(int fd)
+    {
+        ring_queue_detail::CheckpointHeader hdr;
+        if (!ring_queue_detail::read_fully(fd, &hdr, sizeof(hdr)))
+            throw std::runtime_error("RingQueue::unserialize: truncated header");
+        restore(hdr, [&](T* dst, std::size_t bytes) {
+            return ring_queue_detail::read_fully(fd, dst, bytes);
+        });
+    }
+#endif
+
 private:
     // --------------------------------------------------------------------- //
     //                     Internal growth logic
     // --------------------------------------------------------------------- //
 
-    std::vector<T> data_;          ///< Contiguous storage
+    /// cap_mask_ value for "no buffer": capacity() wraps around to 0.
+    static constexpr std::size_t kNoStorage = ~std::size_t(0);
+
+    RING_QUEUE_NO_UNIQUE_ADDRESS
+    Alloc alloc_;                    ///< Supplies data_
+    RING_QUEUE_NO_UNIQUE_ADDRESS
+    Stats stats_;                    ///< Instrumentation (empty when off)
+    T* data_ = nullptr;              ///< Raw storage; only live slots constructed
     std::size_t head_ = 0;           ///< Index of oldest element
     std::size_t tail_ = 0;           ///< Index where next push goes
     std::size_t count_ = 0;          ///< Live element count
-    std::size_t cap_mask_ = 0;       ///< capacity()-1, used for fast wrap
+    std::size_t cap_mask_ = kNoStorage; ///< capacity()-1, used for fast wrap
+
+    // ----------------------------------------------------------------- //
+    //  Raw storage – allocated, never value-initialised.
+    //
+    //  Trivially copyable T can be moved around as bytes, so with the
+    //  default allocator its buffer comes from malloc and growth may
+    //  `realloc` it: the C library extends it in place when it can, and
+    //  remaps the pages (mremap on Linux) for large buffers, instead of
+    //  copying every element. Any other allocator goes through Alloc.
+    // ----------------------------------------------------------------- //
+    static constexpr bool kRelocatable =
+        std::is_same_v<Alloc, std::allocator<T>>
+        && std::is_trivially_copyable_v<T> && alignof(T) <= alignof(std::max_align_t);
+
+    T* allocate(std::size_t n)
+    {
+        if constexpr (kRelocatable) {
+            void* p = std::malloc(n * sizeof(T));
+            if (!p) throw std::bad_alloc();
+            return static_cast<T*>(p);
+        } else {
+            return AllocTraits::allocate(alloc_, n);
+        }
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if constexpr (kRelocatable) {
+            std::free(p);
+        } else {
+            if (p) AllocTraits::deallocate(alloc_, p, n);
+        }
+    }
+
+    void swap_storage(RingQueue& other) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(head_, other.head_);
+        std::swap(tail_, other.tail_);
+        std::swap(count_, other.count_);
+        std::swap(cap_mask_, other.cap_mask_);
+    }
+
+    // Used by assignment when the allocator propagates: the temporary
+    // already holds the allocator this queue must end up with, and takes
+    // the old one along with the old buffer. Without propagation the
+    // temporary's allocator equals ours and only the storage is swapped.
+    void swap_all(RingQueue& other) noexcept
+    {
+        using std::swap;
+        swap(alloc_, other.alloc_);
+        swap_storage(other);
+    }
+
+    // ----------------------------------------------------------------- //
+    //  Visit the n slots starting at physical index `start` as at most two
+    //  contiguous runs: fn(T* run, std::size_t len).
+    // ----------------------------------------------------------------- //
+    template<class Fn>
+    void for_each_run(std::size_t start, std::size_t n, Fn&& fn)
+    {
+        const std::size_t first_len = std::min(n, capacity() - start);
+        if (first_len) fn(data_ + start, first_len);
+        if (n > first_len) fn(data_, n - first_len);
+    }
+
+    static void destroy_prefix(T* p, std::size_t n) noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (std::size_t i = 0; i < n; ++i) p[i].~T();
+        }
+    }
 
     // ----------------------------------------------------------------- //
     //  Ensure room for one more element.
@@ -251,12 +1207,35 @@ private:
     }
 
     // ----------------------------------------------------------------- //
-    //  Double the current capacity.
+    //  Grow by the policy's factor (doubling by default).
     // ----------------------------------------------------------------- //
     void grow()
     {
-        const std::size_t new_cap = capacity() ? capacity() * 2 : 1;
-        grow_to(new_cap);
+        grow_to(Growth::grow(capacity()));
+    }
+
+    // ----------------------------------------------------------------- //
+    //  Automatic shrink after a pop (compiled out unless the policy asks).
+    //  Shrinking is only an optimisation, so a failed reallocation leaves
+    //  the queue as it was and is not reported.
+    // ----------------------------------------------------------------- //
+    void maybe_shrink() noexcept
+    {
+        if constexpr (Growth::kAutoShrink) {
+            if (Growth::should_shrink(count_, capacity())) auto_shrink();
+        }
+    }
+
+    // Out of line so pop() stays small enough to inline.
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((noinline))
+#endif
+    void auto_shrink() noexcept
+    {
+        try {
+            grow_to(Growth::shrink(count_));
+        } catch (...) {
+        }
     }
 
     // ----------------------------------------------------------------- //
@@ -266,68 +1245,156 @@ private:
     {
         static_assert(std::is_unsigned_v<std::size_t>, "std::size_t must be unsigned");
 
-        std::vector<T> new_data(new_cap);               // uninitialized
+        if constexpr (kRelocatable) {
+            relocate_to(new_cap);
+            return;
+        }
+
+        T* new_data = allocate(new_cap);                // uninitialized
         const std::size_t new_mask = new_cap - 1;
 
-        // Copy in logical order, using fast wrap (head_ + i) & old_mask
-        for (std::size_t i = 0; i < count_; ++i) {
-            const std::size_t src = (head_ + i) & cap_mask_;
-            new (&new_data[i]) T(std::move_if_noexcept(data_[src]));
-            data_[src].~T();
+        // Move (or copy) in logical order, using fast wrap (head_ + i) & old_mask.
+        // The old elements stay alive until every copy succeeded, so a
+        // throwing copy constructor leaves the queue untouched.
+        std::size_t i = 0;
+        try {
+            for (; i < count_; ++i) {
+                const std::size_t src = (head_ + i) & cap_mask_;
+                new (new_data + i) T(std::move_if_noexcept(data_[src]));
+            }
+        } catch (...) {
+            destroy_prefix(new_data, i);
+            deallocate(new_data, new_cap);
+            throw;
+        }
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (i = 0; i < count_; ++i) data_[(head_ + i) & cap_mask_].~T();
         }
 
-        data_    = std::move(new_data);
+        stats_.on_resize(capacity(), new_cap, count_ * sizeof(T));
+        deallocate(data_, capacity());
+        data_    = new_data;
         head_    = 0;
-        tail_    = count_;
+        tail_    = count_ & new_mask;          // count_ == new_cap wraps to 0
         cap_mask_ = new_mask;
     }
 
     // ----------------------------------------------------------------- //
-    //  Fast index wrap-around using bit-and.
+    //  grow_to() for trivially copyable T.
+    //
+    //  Growing: realloc keeps [head_, old_cap) and [0, tail_) at their old
+    //  offsets. If the contents wrapped, the shorter of the two runs is
+    //  copied once to close the gap – the wrapped run to just past the old
+    //  end, or the head run to the very end of the new buffer.
+    //  Shrinking: the (at most two) runs are copied to the front of a new
+    //  buffer.
     // ----------------------------------------------------------------- //
-    void advance_head()
+    void relocate_to(std::size_t new_cap)
     {
-        head_ = (head_ + 1) & cap_mask_;
-        --count_;
-    }
-    void advance_tail()
-    {
-        tail_ = (tail_ + 1) & cap_mask_;
-        ++count_;
+        const std::size_t old_cap   = capacity();
+        const std::size_t first_len = std::min(count_, old_cap - head_);
+        const std::size_t wrapped   = count_ - first_len;
+
+        if (data_ && new_cap > old_cap) {
+            void* p = std::realloc(data_, new_cap * sizeof(T));
+            if (!p) throw std::bad_alloc();
+            // A realloc that moved the block counts as moving the live
+            // elements, although the C library may have remapped pages.
+            const std::size_t by_realloc = p != data_ ? count_ * sizeof(T) : 0;
+            data_ = static_cast<T*>(p);
+            if (wrapped <= first_len) {
+                std::memcpy(static_cast<void*>(data_ + old_cap), data_, wrapped * sizeof(T));
+                stats_.on_resize(old_cap, new_cap, by_realloc + wrapped * sizeof(T));
+            } else {
+                const std::size_t new_head = new_cap - first_len;
+                std::memcpy(static_cast<void*>(data_ + new_head), data_ + head_,
+                            first_len * sizeof(T));
+                head_ = new_head;
+                stats_.on_resize(old_cap, new_cap, by_realloc + first_len * sizeof(T));
+            }
+        } else {
+            T* new_data = allocate(new_cap);
+            if (count_) {
+                std::memcpy(static_cast<void*>(new_data), data_ + head_, first_len * sizeof(T));
+                std::memcpy(static_cast<void*>(new_data + first_len), data_, wrapped * sizeof(T));
+            }
+            stats_.on_resize(old_cap, new_cap, count_ * sizeof(T));
+            deallocate(data_, old_cap);
+            data_ = new_data;
+            head_ = 0;
+        }
+        cap_mask_ = new_cap - 1;
+        tail_     = (head_ + count_) & cap_mask_;
     }
 
     // ----------------------------------------------------------------- //
-    //  Power-of-two helpers (compile-time safe)
+    //  Checkpoint helpers. restore() validates the header, fills a fresh
+    //  buffer through read(dst, bytes) and only then swaps it in.
     // ----------------------------------------------------------------- //
-    static constexpr bool is_power_of_two(std::size_t n) noexcept
+    ring_queue_detail::CheckpointHeader checkpoint_header() const noexcept
     {
-        return n > 0 && (n & (n - 1)) == 0;
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "RingQueue checkpoints need a trivially copyable T");
+        ring_queue_detail::CheckpointHeader hdr{};
+        std::memcpy(hdr.magic, ring_queue_detail::kCheckpointMagic, sizeof(hdr.magic));
+        hdr.elem_size = sizeof(T);
+        hdr.count     = count_;
+        hdr.capacity  = capacity();
+        return hdr;
     }
 
-    static std::size_t next_power_of_two(std::size_t n) noexcept
+    template<class Read>
+    void restore(const ring_queue_detail::CheckpointHeader& hdr, Read&& read)
     {
-        if (n == 0) return 1;
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "RingQueue checkpoints need a trivially copyable T");
+        if (std::memcmp(hdr.magic, ring_queue_detail::kCheckpointMagic, sizeof(hdr.magic)) != 0)
+            throw std::runtime_error("RingQueue::unserialize: not a RingQueue checkpoint");
+        if (hdr.elem_size != sizeof(T))
+            throw std::runtime_error("RingQueue::unserialize: element size mismatch");
+        if (hdr.count > hdr.capacity || (hdr.capacity & (hdr.capacity - 1)) != 0 ||
+            hdr.capacity > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::runtime_error("RingQueue::unserialize: corrupt header");
 
-    #if defined(__GNUC__) || defined(__clang__)
-        return std::size_t(1) << (64 - __builtin_clzll(n - 1));
-    #else
-        // Portable fallback (slower, but correct)
-        std::size_t p = 1;
-        while (p < n) p <<= 1;
-        return p;
-    #endif
+        const std::size_t cap = std::max(std::size_t(hdr.capacity), Growth::kMinCapacity);
+        const std::size_t n   = std::size_t(hdr.count);
+        T* buf = allocate(cap);
+        try {
+            if (n && !read(buf, n * sizeof(T)))
+                throw std::runtime_error("RingQueue::unserialize: truncated elements");
+        } catch (...) {
+            deallocate(buf, cap);
+            throw;
+        }
+        deallocate(data_, capacity());
+        data_     = buf;
+        cap_mask_ = cap - 1;
+        head_     = 0;
+        count_    = n;
+        tail_     = n & cap_mask_;
     }
 
-    static std::size_t reserve_power_of_two(std::size_t n)
+    // ----------------------------------------------------------------- //
+    //  Fast index wrap-around using bit-and.
+    // ----------------------------------------------------------------- //
+    void advance_head()
     {
-        const std::size_t cap = next_power_of_two(n);
-        assert(is_power_of_two(cap));
-        return cap;
+        head_ = (head_ + 1) & cap_mask_;
+        --count_;
+    }
+    void advance_tail()
+    {
+        tail_ = (tail_ + 1) & cap_mask_;
+        ++count_;
+        stats_.on_push(count_, 1);
     }
 
     void reset_indices()
     {
         head_ = tail_ = count_ = 0;
-        cap_mask_ = data_.size() - 1;
     }
-};
\ No newline at end of file
+};
+
+/** @brief RingQueue with instrumentation on (see RingStatsOn). */
+template<class T, class Alloc = std::allocator<T>, class Growth = RingGrowthPolicy<>>
+using CountingRingQueue = RingQueue<T, Alloc, Growth, RingStatsOn>;
\ No newline at end of file
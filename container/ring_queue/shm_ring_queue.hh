@@ -0,0 +1,352 @@
+// container/ring_queue/shm_ring_queue.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "ShmRingQueue needs POSIX shared memory (shm_open + mmap)"
+#endif
+
+#include <new>
+#include <atomic>
+#include <algorithm>
+#include <cerrno>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @file   shm_ring_queue.hh
+ * @brief  Ring queue whose header and slots live in a POSIX shared-memory
+ *         segment, for passing messages between processes on one host.
+ *
+ *  * `create(name, cap)` makes the segment (`shm_open` + `mmap`), other
+ *    processes `open(name)` it; each maps it wherever it likes. The
+ *    segment holds only free-running indices and slots – no pointers – so
+ *    every mapping is equally valid.
+ *  * `ShmMode::Spsc`: one producer and one consumer process, the
+ *    SpscRingQueue protocol (each side caches the other's index in its
+ *    own process-local object).
+ *  * `ShmMode::Mpsc`: any number of producer processes and one consumer,
+ *    with MpmcRingQueue's per-slot sequence numbers; producers claim a
+ *    slot with one CAS.
+ *  * Fixed power-of-two capacity (at least 2 in Mpsc mode). T must be
+ *    trivially copyable (the bytes are all another process sees) and the
+ *    atomics address-free.
+ *  * A process that dies inside push / pop leaves the ring inconsistent;
+ *    recovery is up to the application.
+ *  * C++17 (gem5 compatible).
+ */
+
+enum class ShmMode : std::uint32_t { Spsc = 1, Mpsc = 2 };
+
+template<class T, ShmMode Mode = ShmMode::Spsc>
+class ShmRingQueue {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "ShmRingQueue shares raw bytes between processes: T must be trivially copyable");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "ShmRingQueue needs address-free (lock-free) 64-bit atomics");
+    static_assert(alignof(T) <= ring_queue_detail::kCacheLine, "over-aligned T");
+
+  public:
+    using value_type = T;
+
+    //==========================================================================//
+    //  Construction
+    //==========================================================================//
+
+    /**
+     * @brief Creates the segment @p name (e.g. "/sim-events") holding at
+     *        least @p cap elements, and maps it.
+     *
+     * The capacity is rounded up to the next power-of-two; in Mpsc mode
+     * also to at least 2, as for MpmcRingQueue (one slot cannot tell
+     * "full" from "free for the next lap").
+     *
+     * @throws std::system_error if the segment already exists or
+     *         shm_open / ftruncate / mmap fail.
+     */
+    static ShmRingQueue create(const char* name, std::size_t cap = 1024)
+    {
+        assert(cap > 0 && "capacity must be >0");
+        const std::size_t capacity = ring_queue_detail::reserve_power_of_two(
+            Mode == ShmMode::Mpsc ? std::max<std::size_t>(cap, 2) : cap);
+        const std::size_t bytes = kSlotsOffset + capacity * sizeof(Slot);
+
+        const int fd = ::shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd < 0) throw_errno("shm_open");
+        if (::ftruncate(fd, off_t(bytes)) != 0) {
+            const int err = errno;
+            ::close(fd);
+            ::shm_unlink(name);
+            throw_errno("ftruncate", err);
+        }
+        void* base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        const int err = errno;
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            ::shm_unlink(name);
+            throw_errno("mmap", err);
+        }
+
+        // The segment starts zeroed; construct the header, then the slots,
+        // and publish the magic last so open() never sees half a ring.
+        Header* h = new (base) Header;
+        h->mode      = std::uint32_t(Mode);
+        h->elem_size = std::uint32_t(sizeof(T));
+        h->cap_mask  = capacity - 1;
+        Slot* slots = reinterpret_cast<Slot*>(static_cast<char*>(base) + kSlotsOffset);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            new (&slots[i]) Slot;
+            if constexpr (Mode == ShmMode::Mpsc)
+                slots[i].seq.store(i, std::memory_order_relaxed);
+        }
+        h->magic.store(kMagic, std::memory_order_release);
+        return ShmRingQueue(base, bytes);
+    }
+
+    /**
+     * @brief Maps the existing segment @p name, made by create() with the
+     *        same T and Mode.
+     *
+     * @throws std::system_error if shm_open / mmap fail, or with
+     *         `std::errc::invalid_argument` if the segment is not (yet) a
+     *         ring of this type.
+     */
+    static ShmRingQueue open(const char* name)
+    {
+        const int fd = ::shm_open(name, O_RDWR, 0);
+        if (fd < 0) throw_errno("shm_open");
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            const int err = errno;
+            ::close(fd);
+            throw_errno("fstat", err);
+        }
+        const std::size_t bytes = std::size_t(st.st_size);
+        if (bytes < kSlotsOffset) {
+            ::close(fd);
+            throw_errno("ShmRingQueue::open: segment too small", EINVAL);
+        }
+        void* base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        const int err = errno;
+        ::close(fd);
+        if (base == MAP_FAILED) throw_errno("mmap", err);
+
+        ShmRingQueue q(base, bytes);        // unmaps if the checks below throw
+        const Header* h = q.header();
+        if (h->magic.load(std::memory_order_acquire) != kMagic
+            || h->mode != std::uint32_t(Mode) || h->elem_size != sizeof(T)
+            || kSlotsOffset + (h->cap_mask + 1) * sizeof(Slot) != bytes)
+            throw_errno("ShmRingQueue::open: not a ring of this type", EINVAL);
+        return q;
+    }
+
+    /** @brief Removes the name @p name; mappings stay valid until unmapped. */
+    static bool unlink(const char* name) noexcept { return ::shm_unlink(name) == 0; }
+
+    ShmRingQueue(const ShmRingQueue&)            = delete;
+    ShmRingQueue& operator=(const ShmRingQueue&) = delete;
+
+    ShmRingQueue(ShmRingQueue&& other) noexcept
+        : base_(std::exchange(other.base_, nullptr))
+        , bytes_(std::exchange(other.bytes_, 0))
+        , cap_mask_(other.cap_mask_)
+        , head_cache_(other.head_cache_)
+        , tail_cache_(other.tail_cache_)
+    {}
+
+    ShmRingQueue& operator=(ShmRingQueue&& other) noexcept
+    {
+        if (this != &other) {
+            unmap();
+            base_       = std::exchange(other.base_, nullptr);
+            bytes_      = std::exchange(other.bytes_, 0);
+            cap_mask_   = other.cap_mask_;
+            head_cache_ = other.head_cache_;
+            tail_cache_ = other.tail_cache_;
+        }
+        return *this;
+    }
+
+    /** @brief Unmaps this process's view; the segment lives on until unlinked. */
+    ~ShmRingQueue() { unmap(); }
+
+    //==========================================================================//
+    //  Producer API (one process for Spsc, any number for Mpsc)
+    //==========================================================================//
+
+    /**
+     * @brief Pushes @p val if there is room.
+     *
+     * @return `true` on success, `false` if the ring was full.
+     */
+    bool try_push(const T& val) noexcept
+    {
+        Header* h = header();
+        if constexpr (Mode == ShmMode::Spsc) {
+            const std::uint64_t tail = h->tail.load(std::memory_order_relaxed);
+            if (tail - head_cache_ > cap_mask_) {
+                head_cache_ = h->head.load(std::memory_order_acquire);
+                if (tail - head_cache_ > cap_mask_) return false;
+            }
+            slots()[tail & cap_mask_].value = val;
+            h->tail.store(tail + 1, std::memory_order_release);
+        } else {
+            std::uint64_t pos = h->tail.load(std::memory_order_relaxed);
+            Slot* slot;
+            for (;;) {
+                slot = &slots()[pos & cap_mask_];
+                const std::uint64_t seq = slot->seq.load(std::memory_order_acquire);
+                const std::int64_t diff = std::int64_t(seq - pos);
+                if (diff == 0) {
+                    if (h->tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                } else if (diff < 0) {
+                    return false;               // consumer a lap behind → full
+                } else {
+                    pos = h->tail.load(std::memory_order_relaxed);
+                }
+            }
+            slot->value = val;
+            slot->seq.store(pos + 1, std::memory_order_release);
+        }
+        return true;
+    }
+
+    /** @brief Pushes @p val, spinning while the ring is full. */
+    void push(const T& val) noexcept
+    {
+        while (!try_push(val)) relax();
+    }
+
+    //==========================================================================//
+    //  Consumer API (one process)
+    //==========================================================================//
+
+    /**
+     * @brief Copies the oldest element into @p out and removes it.
+     *
+     * @return `true` on success, `false` if the ring was empty.
+     */
+    bool try_pop(T& out) noexcept
+    {
+        Header* h = header();
+        const std::uint64_t head = h->head.load(std::memory_order_relaxed);
+        if constexpr (Mode == ShmMode::Spsc) {
+            if (head == tail_cache_) {
+                tail_cache_ = h->tail.load(std::memory_order_acquire);
+                if (head == tail_cache_) return false;
+            }
+            out = slots()[head & cap_mask_].value;
+        } else {
+            Slot& slot = slots()[head & cap_mask_];
+            if (slot.seq.load(std::memory_order_acquire) != head + 1) return false;
+            out = slot.value;
+            // Hand the slot to the producer of the next lap.
+            slot.seq.store(head + cap_mask_ + 1, std::memory_order_release);
+        }
+        h->head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    /** @brief Approximate element count (a snapshot while others run). */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const std::uint64_t head = header()->head.load(std::memory_order_acquire);
+        const std::uint64_t tail = header()->tail.load(std::memory_order_acquire);
+        return tail > head ? std::size_t(tail - head) : 0;
+    }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /** @brief Fixed capacity (always a power-of-two). */
+    [[nodiscard]] std::size_t capacity() const noexcept { return std::size_t(cap_mask_) + 1; }
+
+private:
+    // Bumped whenever the segment layout changes.
+    static constexpr std::uint64_t kMagic = 0x5248'4d53'0001'0000ull | std::uint64_t(Mode);
+
+    // ----------------------------------------------------------------- //
+    //  Segment layout: Header, then capacity() Slots at kSlotsOffset.
+    //  Everything is an index or a value; nothing depends on where the
+    //  segment is mapped.
+    // ----------------------------------------------------------------- //
+    struct Header {
+        std::atomic<std::uint64_t> magic{0};    ///< kMagic once initialised
+        std::uint32_t mode = 0;
+        std::uint32_t elem_size = 0;
+        std::uint64_t cap_mask = 0;
+
+        alignas(ring_queue_detail::kCacheLine)
+        std::atomic<std::uint64_t> tail{0};     ///< Next position to write
+
+        alignas(ring_queue_detail::kCacheLine)
+        std::atomic<std::uint64_t> head{0};     ///< Next position to read
+    };
+
+    struct SpscSlot {
+        T value;
+    };
+    // MpmcRingQueue's slot: seq == pos → free for lap `pos`, pos+1 → full.
+    struct MpscSlot {
+        std::atomic<std::uint64_t> seq{0};
+        T value;
+    };
+    using Slot = std::conditional_t<Mode == ShmMode::Spsc, SpscSlot, MpscSlot>;
+
+    static constexpr std::size_t kSlotsOffset =
+        (sizeof(Header) + ring_queue_detail::kCacheLine - 1) & ~(ring_queue_detail::kCacheLine - 1);
+
+    // The Spsc caches start from the segment's current indices: a process
+    // may attach long after the other side has moved them.
+    ShmRingQueue(void* base, std::size_t bytes) noexcept
+        : base_(base), bytes_(bytes), cap_mask_(header()->cap_mask)
+        , head_cache_(header()->head.load(std::memory_order_acquire))
+        , tail_cache_(header()->tail.load(std::memory_order_acquire))
+    {}
+
+    Header* header() const noexcept { return static_cast<Header*>(base_); }
+    Slot* slots() const noexcept
+    {
+        return reinterpret_cast<Slot*>(static_cast<char*>(base_) + kSlotsOffset);
+    }
+
+    void unmap() noexcept
+    {
+        if (base_) ::munmap(base_, bytes_);
+        base_ = nullptr;
+    }
+
+    static void relax() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    [[noreturn]] static void throw_errno(const char* what, int err = errno)
+    {
+        throw std::system_error(err, std::generic_category(), what);
+    }
+
+    // Process-local state.
+    void* base_;                          ///< This process's mapping
+    std::size_t bytes_;                   ///< Mapping length
+    std::uint64_t cap_mask_;              ///< Copy of Header::cap_mask
+    std::uint64_t head_cache_ = 0;        ///< Spsc producer's copy of head
+    std::uint64_t tail_cache_ = 0;        ///< Spsc consumer's copy of tail
+};
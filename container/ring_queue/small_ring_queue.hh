@@ -0,0 +1,320 @@
+// container/ring_queue/small_ring_queue.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <new>
+#include <memory>
+#include <cassert>
+#include <cstring>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+
+/**
+ * @file   small_ring_queue.hh
+ * @brief  Growable ring queue with N inline slots (small-buffer optimisation).
+ *
+ *  * Up to N elements live inside the object: constructing, filling and
+ *    destroying a queue that stays small never touches the heap.
+ *  * The (N+1)-th push spills to a heap ring of 2N slots, which then grows
+ *    by doubling like RingQueue. `shrink_to_fit()` moves the elements back
+ *    inline once they fit again.
+ *  * `data_` points at whichever buffer is live, so element access is the
+ *    same branch-free `data_[(head_ + i) & mask]` in both modes; inline,
+ *    that pointer leads into the object's own cache lines.
+ *  * The object moves with its inline elements: moving a small queue moves
+ *    them one by one, moving a spilled queue steals the heap ring.
+ *  * Trivially copyable elements are relocated with memcpy.
+ *  * C++17 (gem5 compatible).
+ */
+template<class T, std::size_t N = 8>
+class SmallRingQueue {
+    static_assert(ring_queue_detail::is_power_of_two(N),
+                  "SmallRingQueue inline capacity must be a power-of-two");
+    static_assert(N <= (std::size_t(1) << 16), "SmallRingQueue inline buffer too large");
+
+  public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using iterator        = ring_queue_detail::RingIterator<T>;
+    using const_iterator  = ring_queue_detail::RingIterator<const T>;
+
+    /// Number of inline slots.
+    static constexpr std::size_t kInline = N;
+
+    //==========================================================================//
+    //  Construction
+    //==========================================================================//
+
+    SmallRingQueue() noexcept : data_(inline_data()) {}
+
+    SmallRingQueue(const SmallRingQueue& other) : SmallRingQueue()
+    {
+        reserve(other.count_);
+        for (std::size_t i = 0; i < other.count_; ++i) emplace(other[i]);
+    }
+
+    SmallRingQueue(SmallRingQueue&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : SmallRingQueue()
+    {
+        take(other);
+    }
+
+    SmallRingQueue& operator=(const SmallRingQueue& other)
+    {
+        if (this != &other) {
+            clear();
+            reserve(other.count_);
+            for (std::size_t i = 0; i < other.count_; ++i) emplace(other[i]);
+        }
+        return *this;
+    }
+
+    SmallRingQueue& operator=(SmallRingQueue&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other) {
+            clear();
+            release_heap();
+            take(other);
+        }
+        return *this;
+    }
+
+    ~SmallRingQueue()
+    {
+        clear();
+        release_heap();
+    }
+
+    //==========================================================================//
+    //  Core API
+    //==========================================================================//
+
+    /** @brief Pushes a value to the back, spilling to the heap when full. */
+    template<class U>
+    void push(U&& val)
+    {
+        emplace(std::forward<U>(val));
+    }
+
+    /**
+     * @brief Constructs an element in-place at the back.
+     *
+     * @return Reference to the new element.
+     */
+    template<class... Args>
+    T& emplace(Args&&... args)
+    {
+        if (count_ == capacity()) grow_to(2 * capacity());
+        T* p = new (data_ + tail()) T(std::forward<Args>(args)...);
+        ++count_;
+        return *p;
+    }
+
+    /** @brief Oldest element. @pre `!empty()`. */
+    T& front()
+    {
+        assert(!empty() && "front() on empty queue");
+        return data_[head_];
+    }
+    const T& front() const
+    {
+        assert(!empty() && "front() on empty queue");
+        return data_[head_];
+    }
+
+    /** @brief Youngest element. @pre `!empty()`. */
+    T& back()
+    {
+        assert(!empty() && "back() on empty queue");
+        return data_[(tail() - 1) & cap_mask_];
+    }
+    const T& back() const
+    {
+        assert(!empty() && "back() on empty queue");
+        return data_[(tail() - 1) & cap_mask_];
+    }
+
+    /** @brief i-th element from the front. @pre `i < size()`. */
+    T& operator[](std::size_t i)
+    {
+        assert(i < count_ && "operator[] out of range");
+        return data_[(head_ + i) & cap_mask_];
+    }
+    const T& operator[](std::size_t i) const
+    {
+        assert(i < count_ && "operator[] out of range");
+        return data_[(head_ + i) & cap_mask_];
+    }
+
+    /** @brief Removes the oldest element. @pre `!empty()`. */
+    void pop()
+    {
+        assert(!empty() && "pop() on empty queue");
+        data_[head_].~T();
+        head_ = (head_ + 1) & cap_mask_;
+        --count_;
+    }
+
+    /** @brief Removes the youngest element. @pre `!empty()`. */
+    void pop_back()
+    {
+        assert(!empty() && "pop_back() on empty queue");
+        --count_;
+        data_[tail()].~T();
+    }
+
+    /** @brief Destroys all elements; the storage is kept. @post `empty()`. */
+    void clear() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (; count_ > 0; --count_, head_ = (head_ + 1) & cap_mask_) data_[head_].~T();
+        }
+        head_ = count_ = 0;
+    }
+
+    //==========================================================================//
+    //  Iteration (see RingQueue for details)
+    //==========================================================================//
+
+    iterator begin() noexcept { return { data_, cap_mask_, head_ }; }
+    iterator end() noexcept { return { data_, cap_mask_, std::size_t(head_) + count_ }; }
+    const_iterator begin() const noexcept { return { data_, cap_mask_, head_ }; }
+    const_iterator end() const noexcept { return { data_, cap_mask_, std::size_t(head_) + count_ }; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /** @brief The live elements as (at most) two contiguous spans. */
+    std::pair<RingSpan<T>, RingSpan<T>> segments() noexcept
+    {
+        const std::size_t first_len = std::min<std::size_t>(count_, capacity() - head_);
+        return { { data_ + head_, first_len }, { data_, count_ - first_len } };
+    }
+    std::pair<RingSpan<const T>, RingSpan<const T>> segments() const noexcept
+    {
+        const std::size_t first_len = std::min<std::size_t>(count_, capacity() - head_);
+        return { { data_ + head_, first_len }, { data_, count_ - first_len } };
+    }
+
+    //==========================================================================//
+    //  Queries / capacity
+    //==========================================================================//
+
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return std::size_t(cap_mask_) + 1; }
+
+    /** @brief True while the elements live in the inline buffer. */
+    [[nodiscard]] bool is_inline() const noexcept { return data_ == inline_data(); }
+
+    /**
+     * @brief Ensures `capacity() >= n`.
+     *
+     * @throws std::length_error if @p n exceeds 2^31 (the 32-bit indices).
+     */
+    void reserve(std::size_t n)
+    {
+        if (n > kMaxCapacity) throw std::length_error("SmallRingQueue capacity too large");
+        if (n > capacity()) grow_to(ring_queue_detail::next_power_of_two(n));
+    }
+
+    /**
+     * @brief Returns a spilled queue to inline storage if `size() <= N`,
+     *        otherwise shrinks the heap ring to the next power-of-two.
+     */
+    void shrink_to_fit()
+    {
+        if (is_inline()) return;
+        const std::size_t want = std::max(ring_queue_detail::next_power_of_two(count_), N);
+        if (want < capacity()) grow_to(want);
+    }
+
+private:
+    // Same union trick as StaticRingQueue: typed but uninitialised slots.
+    union Slot {
+        T value;
+        Slot() noexcept {}
+        ~Slot() {}
+    };
+
+    T* data_;                            ///< inline_data() or a heap ring
+    // 32-bit indices, as in StaticRingQueue: they cannot alias the elements.
+    static constexpr std::size_t kMaxCapacity = std::size_t(1) << 31;
+    std::uint32_t head_ = 0;             ///< Index of oldest element
+    std::uint32_t count_ = 0;            ///< Live element count
+    std::uint32_t cap_mask_ = N - 1;     ///< capacity()-1
+    Slot inline_[N];                     ///< Inline slots
+
+    std::size_t tail() const noexcept { return (std::size_t(head_) + count_) & cap_mask_; }
+
+    T* inline_data() noexcept { return &inline_[0].value; }
+    const T* inline_data() const noexcept { return &inline_[0].value; }
+
+    void release_heap() noexcept
+    {
+        if (is_inline()) return;
+        std::allocator<T>().deallocate(data_, capacity());
+        data_ = inline_data();
+        cap_mask_ = N - 1;
+    }
+
+    // Moves other's elements into *this (empty and inline) and leaves
+    // other empty and inline.
+    void take(SmallRingQueue& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (other.is_inline()) {
+            for (std::size_t i = 0; i < other.count_; ++i) emplace(std::move(other[i]));
+            other.clear();
+        } else {
+            data_     = std::exchange(other.data_, other.inline_data());
+            head_     = std::exchange(other.head_, 0);
+            count_    = std::exchange(other.count_, 0);
+            cap_mask_ = std::exchange(other.cap_mask_, std::uint32_t(N - 1));
+        }
+    }
+
+    // ----------------------------------------------------------------- //
+    //  Relocate to a ring of exactly new_cap (power-of-two, >= count_):
+    //  the inline buffer when new_cap == N, else a fresh heap ring. The
+    //  elements land at the front in logical order; as in RingQueue, a
+    //  throwing copy leaves the queue untouched.
+    // ----------------------------------------------------------------- //
+    void grow_to(std::size_t new_cap)
+    {
+        assert(ring_queue_detail::is_power_of_two(new_cap) && new_cap >= count_);
+        if (new_cap > kMaxCapacity) throw std::length_error("SmallRingQueue capacity too large");
+        const bool to_inline = new_cap == N;
+        assert((!to_inline || !is_inline()) && "already inline");
+        T* dst = to_inline ? inline_data() : std::allocator<T>().allocate(new_cap);
+
+        const std::size_t first_len = std::min<std::size_t>(count_, capacity() - head_);
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (count_) {
+                std::memcpy(static_cast<void*>(dst), data_ + head_, first_len * sizeof(T));
+                std::memcpy(static_cast<void*>(dst + first_len), data_, (count_ - first_len) * sizeof(T));
+            }
+        } else {
+            std::size_t i = 0;
+            try {
+                for (; i < count_; ++i)
+                    new (dst + i) T(std::move_if_noexcept(data_[(head_ + i) & cap_mask_]));
+            } catch (...) {
+                for (std::size_t j = 0; j < i; ++j) dst[j].~T();
+                if (!to_inline) std::allocator<T>().deallocate(dst, new_cap);
+                throw;
+            }
+            for (i = 0; i < count_; ++i) data_[(head_ + i) & cap_mask_].~T();
+        }
+
+        if (!is_inline()) std::allocator<T>().deallocate(data_, capacity());
+        data_     = dst;
+        head_     = 0;
+        cap_mask_ = std::uint32_t(new_cap - 1);
+    }
+};
@@ -0,0 +1,294 @@
+// container/ring_queue/soa_ring_queue.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <tuple>
+#include <memory>
+#include <cassert>
+#include <cstring>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+/**
+ * @file   soa_ring_queue.hh
+ * @brief  Structure-of-arrays ring queue: one column per record field.
+ *
+ *  * `SoaRingQueue<Ts...>` stores a record `(Ts...)` as one slot in each
+ *    of `sizeof...(Ts)` power-of-two columns. All columns share a single
+ *    head / tail / count, so push and pop cost one index update.
+ *  * `segments<I>()` returns field I of the live records as (at most) two
+ *    dense spans. A loop over one field touches only that column's cache
+ *    lines and vectorises like a plain array scan.
+ *  * Fields must be trivially copyable (growth is a memcpy per column).
+ *  * C++17 (gem5 compatible).
+ */
+template<class... Ts>
+class SoaRingQueue {
+    static_assert(sizeof...(Ts) > 0, "SoaRingQueue needs at least one field");
+    static_assert((std::is_trivially_copyable_v<Ts> && ...),
+                  "SoaRingQueue fields must be trivially copyable");
+
+    using Index = std::index_sequence_for<Ts...>;
+
+  public:
+    using value_type = std::tuple<Ts...>;
+    using reference  = std::tuple<Ts&...>;
+    using const_reference = std::tuple<const Ts&...>;
+    using size_type  = std::size_t;
+
+    /// Type of field I.
+    template<std::size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+    //==========================================================================//
+    //  Construction
+    //==========================================================================//
+
+    /**
+     * @brief Constructs a queue with at least @p init_cap record slots.
+     *
+     * @post `capacity()` is a power-of-two and `size() == 0`.
+     */
+    explicit SoaRingQueue(std::size_t init_cap = 16)
+        : cap_mask_(ring_queue_detail::reserve_power_of_two(init_cap) - 1)
+    {
+        assert(init_cap > 0 && "initial capacity must be >0");
+        cols_ = allocate_columns(capacity(), Index{});
+    }
+
+    /** @brief Copies @p other column by column, keeping its layout. */
+    SoaRingQueue(const SoaRingQueue& other)
+        : SoaRingQueue(std::max(other.capacity(), std::size_t(1)))
+    {
+        if (other.count_ == 0) return;
+        copy_columns(other, Index{});
+        head_  = other.head_;
+        count_ = other.count_;
+    }
+
+    SoaRingQueue(SoaRingQueue&& other) noexcept
+        : cols_(std::exchange(other.cols_, {}))
+        , head_(std::exchange(other.head_, 0))
+        , count_(std::exchange(other.count_, 0))
+        , cap_mask_(std::exchange(other.cap_mask_, kNoStorage))
+    {}
+
+    /** @brief Copy/move assignment (copy-and-swap). */
+    SoaRingQueue& operator=(SoaRingQueue other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~SoaRingQueue() { deallocate_columns(cols_, capacity(), Index{}); }
+
+    void swap(SoaRingQueue& other) noexcept
+    {
+        std::swap(cols_, other.cols_);
+        std::swap(head_, other.head_);
+        std::swap(count_, other.count_);
+        std::swap(cap_mask_, other.cap_mask_);
+    }
+
+    //==========================================================================//
+    //  Core API
+    //==========================================================================//
+
+    /**
+     * @brief Appends a record given field by field.
+     *
+     * Fields are taken by value, so they may alias elements of this queue.
+     */
+    void push(Ts... fields)
+    {
+        if (full()) grow_to(capacity() ? capacity() * 2 : 1);
+        store(tail(), Index{}, fields...);
+        ++count_;
+    }
+
+    /** @brief Appends a record given as a tuple. */
+    void push(const value_type& rec)
+    {
+        std::apply([this](const Ts&... f) { push(f...); }, rec);
+    }
+
+    /** @brief Removes the oldest record. @pre `!empty()`. */
+    void pop()
+    {
+        assert(!empty() && "pop() on empty queue");
+        head_ = (head_ + 1) & cap_mask_;
+        --count_;
+    }
+
+    /**
+     * @brief Removes the @p n oldest records at once – e.g. after a scan.
+     *
+     * @pre `n <= size()`.
+     */
+    void consume(std::size_t n) noexcept
+    {
+        assert(n <= count_ && "consume() beyond size()");
+        head_ = (head_ + n) & cap_mask_;
+        count_ -= n;
+    }
+
+    /** @brief Removes all records. @post `empty()`. */
+    void clear() noexcept { head_ = count_ = 0; }
+
+    //==========================================================================//
+    //  Access
+    //==========================================================================//
+
+    /** @brief Field I of the i-th record from the front. @pre `i < size()`. */
+    template<std::size_t I>
+    field_type<I>& get(std::size_t i)
+    {
+        assert(i < count_ && "get() out of range");
+        return std::get<I>(cols_)[(head_ + i) & cap_mask_];
+    }
+    template<std::size_t I>
+    const field_type<I>& get(std::size_t i) const
+    {
+        assert(i < count_ && "get() out of range");
+        return std::get<I>(cols_)[(head_ + i) & cap_mask_];
+    }
+
+    /** @brief i-th record as a tuple of references. @pre `i < size()`. */
+    reference operator[](std::size_t i)
+    {
+        assert(i < count_ && "operator[] out of range");
+        return row<reference>((head_ + i) & cap_mask_, Index{});
+    }
+    const_reference operator[](std::size_t i) const
+    {
+        assert(i < count_ && "operator[] out of range");
+        return row<const_reference>((head_ + i) & cap_mask_, Index{});
+    }
+
+    reference front()             { assert(!empty() && "front() on empty queue"); return (*this)[0]; }
+    const_reference front() const { assert(!empty() && "front() on empty queue"); return (*this)[0]; }
+    reference back()              { assert(!empty() && "back() on empty queue"); return (*this)[count_ - 1]; }
+    const_reference back() const  { assert(!empty() && "back() on empty queue"); return (*this)[count_ - 1]; }
+
+    /**
+     * @brief Field I of all live records as (at most) two contiguous spans.
+     *
+     * Same layout as RingQueue::segments(): `first` starts at the head,
+     * `second` holds the wrapped part and may be empty.
+     */
+    template<std::size_t I>
+    std::pair<RingSpan<field_type<I>>, RingSpan<field_type<I>>> segments() noexcept
+    {
+        auto* col = std::get<I>(cols_);
+        const std::size_t first_len = std::min(count_, capacity() - head_);
+        return { { col + head_, first_len }, { col, count_ - first_len } };
+    }
+    template<std::size_t I>
+    std::pair<RingSpan<const field_type<I>>, RingSpan<const field_type<I>>>
+    segments() const noexcept
+    {
+        const auto* col = std::get<I>(cols_);
+        const std::size_t first_len = std::min(count_, capacity() - head_);
+        return { { col + head_, first_len }, { col, count_ - first_len } };
+    }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] bool full() const noexcept { return count_ == capacity(); }
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return cap_mask_ + 1; }
+
+    /** @brief Ensures `capacity() >= n`. */
+    void reserve(std::size_t n)
+    {
+        if (n > capacity()) grow_to(ring_queue_detail::next_power_of_two(n));
+    }
+
+private:
+    /// cap_mask_ value for "no buffer": capacity() wraps around to 0.
+    static constexpr std::size_t kNoStorage = ~std::size_t(0);
+
+    std::tuple<Ts*...> cols_{};      ///< One buffer per field
+    std::size_t head_ = 0;           ///< Slot of the oldest record
+    std::size_t count_ = 0;          ///< Live record count
+    std::size_t cap_mask_ = kNoStorage; ///< capacity()-1, shared by all columns
+
+    std::size_t tail() const noexcept { return (head_ + count_) & cap_mask_; }
+
+    // ----------------------------------------------------------------- //
+    //  Per-column helpers, expanded over the field pack.
+    // ----------------------------------------------------------------- //
+    template<std::size_t... I>
+    void store(std::size_t slot, std::index_sequence<I...>, const Ts&... fields) noexcept
+    {
+        ((std::get<I>(cols_)[slot] = fields), ...);
+    }
+
+    template<class Row, std::size_t... I>
+    Row row(std::size_t slot, std::index_sequence<I...>) const noexcept
+    {
+        return Row(std::get<I>(cols_)[slot]...);
+    }
+
+    // All columns or none: a failed allocation frees the ones before it.
+    template<std::size_t... I>
+    static std::tuple<Ts*...> allocate_columns(std::size_t cap, std::index_sequence<I...>)
+    {
+        std::tuple<Ts*...> cols{};
+        try {
+            ((std::get<I>(cols) = std::allocator<Ts>().allocate(cap)), ...);
+        } catch (...) {
+            deallocate_columns(cols, cap, Index{});
+            throw;
+        }
+        return cols;
+    }
+
+    template<std::size_t... I>
+    static void deallocate_columns(const std::tuple<Ts*...>& cols, std::size_t cap,
+                                   std::index_sequence<I...>) noexcept
+    {
+        ((std::get<I>(cols) ? std::allocator<Ts>().deallocate(std::get<I>(cols), cap)
+                            : void()), ...);
+    }
+
+    template<std::size_t... I>
+    void copy_columns(const SoaRingQueue& other, std::index_sequence<I...>) noexcept
+    {
+        (copy_column(std::get<I>(cols_), std::get<I>(other.cols_), capacity()), ...);
+    }
+
+    template<class T>
+    static void copy_column(T* dst, const T* src, std::size_t n) noexcept
+    {
+        if (n) std::memcpy(static_cast<void*>(dst), src, n * sizeof(T));
+    }
+
+    // ----------------------------------------------------------------- //
+    //  Grow to *exactly* new_cap (power-of-two): every column's live run
+    //  is copied to the front of its new buffer, as in RingQueue.
+    // ----------------------------------------------------------------- //
+    void grow_to(std::size_t new_cap)
+    {
+        std::tuple<Ts*...> fresh = allocate_columns(new_cap, Index{});
+        relocate_columns(fresh, Index{});
+        deallocate_columns(cols_, capacity(), Index{});
+        cols_     = fresh;
+        head_     = 0;
+        cap_mask_ = new_cap - 1;
+    }
+
+    template<std::size_t... I>
+    void relocate_columns(const std::tuple<Ts*...>& fresh, std::index_sequence<I...>) noexcept
+    {
+        const std::size_t first_len = std::min(count_, capacity() - head_);
+        ((copy_column(std::get<I>(fresh), std::get<I>(cols_) + head_, first_len),
+          copy_column(std::get<I>(fresh) + first_len, std::get<I>(cols_), count_ - first_len)), ...);
+    }
+};
@@ -0,0 +1,204 @@
+// container/ring_queue/spsc_ring_queue.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <atomic>
+#include <memory>
+#include <cassert>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @file   spsc_ring_queue.hh
+ * @brief  Lock-free single-producer / single-consumer ring queue.
+ *
+ *  * Same power-of-two layout as RingQueue → wrap-around is `& cap_mask_`.
+ *  * Fixed capacity (no growth) – `try_push` reports a full queue.
+ *  * Head and tail live on separate cache lines; each side keeps a cached
+ *    copy of the remote index so the fast path touches no shared line.
+ *  * Exactly one thread may call the producer API and exactly one thread
+ *    the consumer API.
+ *  * C++17 (gem5 compatible).
+ */
+template<class T>
+class SpscRingQueue {
+  public:
+    //==========================================================================//
+    //  Construction
+    //==========================================================================//
+
+    /**
+     * @brief Constructs an SPSC queue holding at least @p cap elements.
+     *
+     * The capacity is rounded up to the next power-of-two. Unlike RingQueue
+     * the buffer never grows, so choose it for the worst-case backlog.
+     *
+     * @param cap  Desired minimum capacity (default = 1024). Must be > 0.
+     *
+     * @post `capacity()` is a power-of-two and the queue is empty.
+     */
+    explicit SpscRingQueue(std::size_t cap = 1024)
+        : cap_mask_(ring_queue_detail::reserve_power_of_two(cap) - 1)
+        , data_(std::allocator<T>().allocate(cap_mask_ + 1))
+    {
+        assert(cap > 0 && "capacity must be >0");
+    }
+
+    SpscRingQueue(const SpscRingQueue&)            = delete;
+    SpscRingQueue& operator=(const SpscRingQueue&) = delete;
+
+    ~SpscRingQueue()
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        for (std::size_t i = head_.load(std::memory_order_relaxed); i != tail; ++i)
+            data_[i & cap_mask_].~T();
+        std::allocator<T>().deallocate(data_, cap_mask_ + 1);
+    }
+
+    //==========================================================================//
+    //  Producer API
+    //==========================================================================//
+
+    /**
+     * @brief Pushes a value if there is room.
+     *
+     * @return `true` on success, `false` if the queue was full (in which
+     *         case @p val is left untouched).
+     *
+     * @note Producer thread only.
+     */
+    template<class U>
+    bool try_push(U&& val)
+    {
+        return try_emplace(std::forward<U>(val));
+    }
+
+    /**
+     * @brief Constructs an element in-place if there is room.
+     *
+     * @return `true` on success, `false` if the queue was full.
+     *
+     * @note Producer thread only. If the constructor throws the queue is
+     *       left unchanged.
+     */
+    template<class... Args>
+    bool try_emplace(Args&&... args)
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_cache_ > cap_mask_) {
+            // Looks full – refresh our view of the consumer.
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ > cap_mask_) return false;
+        }
+        new (data_ + (tail & cap_mask_)) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pushes a value, spinning while the queue is full.
+     *
+     * @note Producer thread only.
+     */
+    template<class U>
+    void push(U&& val)
+    {
+        while (!try_emplace(std::forward<U>(val))) {}
+    }
+
+    //==========================================================================//
+    //  Consumer API
+    //==========================================================================//
+
+    /**
+     * @brief Returns the oldest element, or `nullptr` if the queue is empty.
+     *
+     * The element stays in the queue until pop() is called.
+     *
+     * @note Consumer thread only.
+     */
+    T* front()
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_) return nullptr;
+        }
+        return data_ + (head & cap_mask_);
+    }
+
+    /**
+     * @brief Removes the oldest element.
+     *
+     * @pre `front() != nullptr` (checked by the same consumer thread).
+     *
+     * @note Consumer thread only.
+     */
+    void pop()
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        assert(head != tail_cache_ && "pop() on empty queue");
+        data_[head & cap_mask_].~T();
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Moves the oldest element into @p out and removes it.
+     *
+     * @return `true` on success, `false` if the queue was empty.
+     *
+     * @note Consumer thread only.
+     */
+    bool try_pop(T& out)
+    {
+        T* p = front();
+        if (!p) return false;
+        out = std::move(*p);
+        pop();
+        return true;
+    }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    /**
+     * @brief Returns the number of stored elements.
+     *
+     * Exact when called from either endpoint while the other is idle;
+     * otherwise a snapshot that may already be stale.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    /** @brief `true` if size() == 0 (same caveats as size()). */
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /** @brief Fixed capacity (always a power-of-two). */
+    [[nodiscard]] std::size_t capacity() const noexcept { return cap_mask_ + 1; }
+
+private:
+    // Indices are free-running counters; only the slot lookup is masked, so
+    // all capacity() slots are usable and `tail - head` is the size.
+
+    // Read-only after construction – shared freely by both sides.
+    alignas(ring_queue_detail::kCacheLine)
+    std::size_t cap_mask_;                 ///< capacity()-1
+    T* data_;                              ///< Raw slot storage
+
+    // Consumer-owned line.
+    alignas(ring_queue_detail::kCacheLine)
+    std::atomic<std::size_t> head_{0};     ///< Next slot to pop
+    std::size_t tail_cache_ = 0;           ///< Consumer's copy of tail_
+
+    // Producer-owned line.
+    alignas(ring_queue_detail::kCacheLine)
+    std::atomic<std::size_t> tail_{0};     ///< Next slot to fill
+    std::size_t head_cache_ = 0;           ///< Producer's copy of head_
+};
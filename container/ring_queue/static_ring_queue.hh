@@ -0,0 +1,432 @@
+// container/ring_queue/static_ring_queue.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <new>
+#include <cassert>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+
+/**
+ * @file   static_ring_queue.hh
+ * @brief  Fixed-capacity ring queue with inline storage.
+ *
+ *  * Capacity N is a compile-time power-of-two → the wrap mask is a
+ *    constant folded into every index computation.
+ *  * Storage lives inside the object – no heap allocation, no growth check.
+ *  * Same API as RingQueue, so a buffer can be swapped per use site;
+ *    `try_push` / `try_emplace` report a full queue instead of growing.
+ *  * C++17 (gem5 compatible).
+ */
+template<class T, std::size_t N>
+class StaticRingQueue {
+    static_assert(ring_queue_detail::is_power_of_two(N),
+                  "StaticRingQueue capacity must be a power-of-two");
+    static_assert(N <= (std::size_t(1) << 31), "StaticRingQueue capacity too large");
+
+    static constexpr std::size_t kMask = N - 1;
+
+  public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using iterator        = ring_queue_detail::RingIterator<T>;
+    using const_iterator  = ring_queue_detail::RingIterator<const T>;
+
+    //==========================================================================//
+    //  Construction
+    //==========================================================================//
+
+    StaticRingQueue() noexcept = default;
+
+    // Delegating first makes this a complete object, so the destructor
+    // cleans up the elements already built if a copy throws.
+    StaticRingQueue(const StaticRingQueue& other) : StaticRingQueue()
+    {
+        for (std::size_t i = 0; i < other.count_; ++i) emplace(other[i]);
+    }
+
+    StaticRingQueue(StaticRingQueue&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : StaticRingQueue()
+    {
+        for (std::size_t i = 0; i < other.count_; ++i) emplace(std::move(other[i]));
+        other.clear();
+    }
+
+    StaticRingQueue& operator=(const StaticRingQueue& other)
+    {
+        if (this != &other) {
+            clear();
+            for (std::size_t i = 0; i < other.count_; ++i) emplace(other[i]);
+        }
+        return *this;
+    }
+
+    StaticRingQueue& operator=(StaticRingQueue&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other) {
+            clear();
+            for (std::size_t i = 0; i < other.count_; ++i) emplace(std::move(other[i]));
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~StaticRingQueue() { clear(); }
+
+    //==========================================================================//
+    //  Core API
+    //==========================================================================//
+
+    /**
+     * @brief Pushes a value to the back of the queue.
+     *
+     * @pre `!full()` – the queue never grows. Use try_push() when the
+     *      producer cannot rule out a full buffer.
+     */
+    template<class U>
+    void push(U&& val)
+    {
+        assert(!full() && "push() on full StaticRingQueue");
+        new (slot(tail())) T(std::forward<U>(val));
+        ++count_;
+    }
+
+    /**
+     * @brief Constructs an object in-place at the back of the queue.
+     *
+     * @return Reference to the newly constructed element.
+     *
+     * @pre `!full()`.
+     */
+    template<class... Args>
+    T& emplace(Args&&... args)
+    {
+        assert(!full() && "emplace() on full StaticRingQueue");
+        T* p = new (slot(tail())) T(std::forward<Args>(args)...);
+        ++count_;
+        return *p;
+    }
+
+    /**
+     * @brief Pushes a value if there is room.
+     *
+     * @return `true` on success, `false` if the queue was full.
+     */
+    template<class U>
+    bool try_push(U&& val)
+    {
+        if (full()) return false;
+        push(std::forward<U>(val));
+        return true;
+    }
+
+    /**
+     * @brief Constructs an element in-place if there is room.
+     *
+     * @return `true` on success, `false` if the queue was full.
+     */
+    template<class... Args>
+    bool try_emplace(Args&&... args)
+    {
+        if (full()) return false;
+        emplace(std::forward<Args>(args)...);
+        return true;
+    }
+
+    /** @brief Oldest element. @pre `!empty()`. */
+    T& front()
+    {
+        assert(!empty() && "front() on empty queue");
+        return *slot(head_);
+    }
+
+    /** @brief Oldest element (read-only). @pre `!empty()`. */
+    const T& front() const
+    {
+        assert(!empty() && "front() on empty queue");
+        return *slot(head_);
+    }
+
+    /** @brief Youngest element. @pre `!empty()`. */
+    T& back()
+    {
+        assert(!empty() && "back() on empty queue");
+        return *slot((tail() - 1) & kMask);
+    }
+
+    /** @brief Youngest element (read-only). @pre `!empty()`. */
+    const T& back() const
+    {
+        assert(!empty() && "back() on empty queue");
+        return *slot((tail() - 1) & kMask);
+    }
+
+    /** @brief i-th element from the front. @pre `i < size()`. */
+    T& operator[](std::size_t i)
+    {
+        assert(i < count_ && "operator[] out of range");
+        return *slot((head_ + i) & kMask);
+    }
+
+    /** @brief Read-only variant of operator[]. */
+    const T& operator[](std::size_t i) const
+    {
+        assert(i < count_ && "operator[] out of range");
+        return *slot((head_ + i) & kMask);
+    }
+
+    /**
+     * @brief Removes the front element.
+     *
+     * @pre `!empty()`.
+     */
+    void pop()
+    {
+        assert(!empty() && "pop() on empty queue");
+        slot(head_)->~T();
+        head_ = (head_ + 1) & kMask;
+        --count_;
+    }
+
+    //==========================================================================//
+    //  Double-ended API (see RingQueue for details)
+    //==========================================================================//
+
+    /** @brief Pushes a value to the front. @pre `!full()`. */
+    template<class U>
+    void push_front(U&& val)
+    {
+        emplace_front(std::forward<U>(val));
+    }
+
+    /** @brief Constructs an element in-place at the front. @pre `!full()`. */
+    template<class... Args>
+    T& emplace_front(Args&&... args)
+    {
+        assert(!full() && "emplace_front() on full StaticRingQueue");
+        const std::size_t pos = (head_ - 1) & kMask;
+        T* p = new (slot(pos)) T(std::forward<Args>(args)...);
+        head_ = std::uint32_t(pos);
+        ++count_;
+        return *p;
+    }
+
+    /** @brief Removes the youngest element. @pre `!empty()`. */
+    void pop_back()
+    {
+        assert(!empty() && "pop_back() on empty queue");
+        --count_;
+        slot(tail())->~T();
+    }
+
+    /**
+     * @brief Removes the @p n youngest elements; an index update only for
+     *        trivially destructible `T`.
+     *
+     * @pre `n <= size()`.
+     */
+    void truncate_back(std::size_t n)
+    {
+        assert(n <= count_ && "truncate_back() beyond size()");
+        count_ -= std::uint32_t(n);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for_each_run(tail(), n, [](T* run, std::size_t len) {
+                for (std::size_t i = 0; i < len; ++i) run[i].~T();
+            });
+        }
+    }
+
+    //==========================================================================//
+    //  Bulk API (see RingQueue for details)
+    //==========================================================================//
+
+    /**
+     * @brief Appends `[first, last)`.
+     *
+     * @pre `size() + distance(first, last) <= capacity()`.
+     *
+     * @return Number of elements appended.
+     */
+    template<class InputIt>
+    std::size_t push_n(InputIt first, InputIt last)
+    {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (!std::is_base_of_v<std::forward_iterator_tag, Category>) {
+            std::size_t n = 0;
+            for (; first != last; ++first, ++n) push(*first);
+            return n;
+        } else {
+            const std::size_t n = std::distance(first, last);
+            assert(count_ + n <= N && "push_n() overflows StaticRingQueue");
+
+            std::size_t done = 0;
+            const std::size_t start = tail();
+            try {
+                for_each_run(start, n, [&](T* run, std::size_t len) {
+                    if constexpr (ring_queue_detail::is_memcpy_source_v<T, InputIt>) {
+                        ring_queue_detail::copy_run(run, &*first, len);
+                        first += len;
+                        done += len;
+                    } else {
+                        for (std::size_t i = 0; i < len; ++i, ++first, ++done)
+                            new (run + i) T(*first);
+                    }
+                });
+            } catch (...) {
+                for (std::size_t i = 0; i < done; ++i) slot((start + i) & kMask)->~T();
+                throw;
+            }
+            count_ += n;
+            return n;
+        }
+    }
+
+    /**
+     * @brief Moves up to @p n elements from the front into @p out.
+     *
+     * If an assignment through @p out throws, the elements already handed
+     * over stay popped and the rest stay queued.
+     *
+     * @return Number of elements popped (`min(n, size())`).
+     */
+    template<class OutputIt>
+    std::size_t pop_n(OutputIt out, std::size_t n)
+    {
+        n = std::min<std::size_t>(n, count_);
+        if constexpr (std::is_trivially_copyable_v<T> && std::is_same_v<OutputIt, T*>) {
+            for_each_run(head_, n, [&](T* run, std::size_t len) {
+                ring_queue_detail::copy_run(out, run, len);
+                out += len;
+            });
+            head_ = (head_ + n) & kMask;
+            count_ -= n;
+        } else {
+            // One element at a time, so a throwing `*out =` leaves the
+            // queue consistent.
+            for_each_run(head_, n, [&](T* run, std::size_t len) {
+                for (std::size_t i = 0; i < len; ++i, ++out) {
+                    *out = std::move(run[i]);
+                    run[i].~T();
+                    head_ = (head_ + 1) & kMask;
+                    --count_;
+                }
+            });
+        }
+        return n;
+    }
+
+    /**
+     * @brief Hands every element to `f(T* first, std::size_t len)` as at
+     *        most two runs, then empties the queue.
+     *
+     * @return Number of elements drained.
+     */
+    template<class F>
+    std::size_t drain(F&& f)
+    {
+        const std::size_t n = count_;
+        for_each_run(head_, n, [&](T* run, std::size_t len) { f(run, len); });
+        clear();
+        return n;
+    }
+
+    /** @brief Destroys all elements. @post `empty()`. */
+    void clear() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (; count_ > 0; --count_, head_ = (head_ + 1) & kMask) slot(head_)->~T();
+        }
+        head_ = count_ = 0;
+    }
+
+    //==========================================================================//
+    //  Iteration (see RingQueue for details)
+    //==========================================================================//
+
+    iterator begin() noexcept { return { slot(0), kMask, head_ }; }
+    iterator end() noexcept { return { slot(0), kMask, std::size_t(head_) + count_ }; }
+    const_iterator begin() const noexcept { return { slot(0), kMask, head_ }; }
+    const_iterator end() const noexcept { return { slot(0), kMask, std::size_t(head_) + count_ }; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /** @brief The live elements as (at most) two contiguous spans. */
+    std::pair<RingSpan<T>, RingSpan<T>> segments() noexcept
+    {
+        const std::size_t first_len = std::min<std::size_t>(count_, N - head_);
+        return { { slot(head_), first_len }, { slot(0), count_ - first_len } };
+    }
+
+    /** @brief Read-only variant of segments(). */
+    std::pair<RingSpan<const T>, RingSpan<const T>> segments() const noexcept
+    {
+        const std::size_t first_len = std::min<std::size_t>(count_, N - head_);
+        return { { slot(head_), first_len }, { slot(0), count_ - first_len } };
+    }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    [[nodiscard]] bool full() const noexcept { return count_ == N; }
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] static constexpr std::size_t capacity() noexcept { return N; }
+
+    /**
+     * @brief Capacity is fixed; only checks that @p n fits.
+     *
+     * @pre `n <= capacity()`.
+     */
+    void reserve([[maybe_unused]] std::size_t n) noexcept
+    {
+        assert(n <= N && "reserve() beyond StaticRingQueue capacity");
+    }
+
+    /** @brief No-op: inline storage cannot shrink. */
+    void shrink_to_fit() noexcept {}
+
+private:
+    // A union slot keeps T uninitialised until placement-new while still
+    // giving the storage T's type, which keeps alias analysis precise.
+    union Slot {
+        T value;
+        Slot() noexcept {}
+        ~Slot() {}
+    };
+    Slot storage_[N];                ///< Inline slots
+    // 32-bit indices: unlike std::size_t they cannot alias a `long` or
+    // pointer element under strict aliasing, so stores into storage_ do not
+    // force the compiler to reload them.
+    std::uint32_t head_ = 0;         ///< Index of oldest element
+    std::uint32_t count_ = 0;        ///< Live element count
+
+    std::size_t tail() const noexcept { return (head_ + count_) & kMask; }
+
+    T* slot(std::size_t i) noexcept
+    {
+        return &storage_[i].value;
+    }
+    const T* slot(std::size_t i) const noexcept
+    {
+        return &storage_[i].value;
+    }
+
+    template<class Fn>
+    void for_each_run(std::size_t start, std::size_t n, Fn&& fn)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        if (n > N) __builtin_unreachable();     // lets the compiler bound the runs
+#endif
+        const std::size_t first_len = std::min(n, N - start);
+        if (first_len) fn(slot(start), first_len);
+        if (n > first_len) fn(slot(0), n - first_len);
+    }
+};
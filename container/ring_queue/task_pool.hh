@@ -0,0 +1,261 @@
+// container/ring_queue/task_pool.hh
+#pragma once
+
+#include "work_stealing_deque.hh"
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <condition_variable>
+
+/**
+ * @file   task_pool.hh
+ * @brief  Fork-join task pool on per-worker WorkStealingDeques.
+ *
+ *  * `run(root)` executes `root` on the calling thread, which becomes
+ *    worker 0; the other workers wake up and steal until it returns.
+ *  * Inside, `spawn(group, f)` pushes a task on the current worker's own
+ *    deque (no shared write); `wait(group)` runs tasks – its own newest
+ *    first, then stolen ones – until the group is done. A worker never
+ *    blocks while there is work anywhere.
+ *  * Idle workers yield between steal attempts during a run(); after
+ *    kSpinSteals misses in a row they park until spawn() publishes a
+ *    task or the run ends, so a pool with nothing to steal does not burn
+ *    its cores. Between runs they sleep on a condition variable.
+ *  * Tasks are heap-allocated closures; exceptions escaping a task
+ *    terminate.
+ *  * C++17 (gem5 compatible).
+ */
+
+/** @brief Counts a set of spawned tasks; `TaskPool::wait` until zero. */
+class TaskGroup {
+  public:
+    TaskGroup() = default;
+    TaskGroup(const TaskGroup&)            = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+    ~TaskGroup() { assert(done() && "TaskGroup destroyed with tasks in flight"); }
+
+    [[nodiscard]] bool done() const noexcept
+    {
+        return pending_.load(std::memory_order_acquire) == 0;
+    }
+
+  private:
+    friend class TaskPool;
+    std::atomic<std::size_t> pending_{0};
+};
+
+class TaskPool {
+  public:
+    /** @brief Starts `threads - 1` background workers (the caller of run() is the last). */
+    explicit TaskPool(unsigned threads = std::max(1u, std::thread::hardware_concurrency()))
+    {
+        assert(threads > 0 && "TaskPool needs at least one worker");
+        for (unsigned i = 0; i < threads; ++i) workers_.push_back(std::make_unique<Worker>());
+        for (unsigned i = 1; i < threads; ++i) threads_.emplace_back([this, i] { background(i); });
+    }
+
+    TaskPool(const TaskPool&)            = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    ~TaskPool()
+    {
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& t : threads_) t.join();
+    }
+
+    /** @brief Number of workers, the run() caller included. */
+    [[nodiscard]] unsigned size() const noexcept { return unsigned(workers_.size()); }
+
+    /**
+     * @brief Runs @p root on the calling thread with the pool's help.
+     *
+     * @pre Not called from inside another run() of this pool.
+     */
+    template<class F>
+    void run(F&& root)
+    {
+        assert(current().pool != this && "nested TaskPool::run()");
+        struct Session {
+            TaskPool& pool;
+            const Context saved = std::exchange(current(), Context{ &pool, 0 });
+            ~Session()
+            {
+                {
+                    std::lock_guard<std::mutex> lk(pool.m_);
+                    pool.active_.store(false, std::memory_order_relaxed);
+                }
+                pool.work_cv_.notify_all();             // unpark idle workers
+                current() = saved;
+            }
+        } session{ *this };
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            active_.store(true, std::memory_order_relaxed);
+        }
+        cv_.notify_all();
+        std::forward<F>(root)();
+    }
+
+    /**
+     * @brief Queues `f()` as a task of @p group on the current worker.
+     *
+     * @pre Called from inside run() – by root or by a task.
+     */
+    template<class F>
+    void spawn(TaskGroup& group, F&& f)
+    {
+        assert(current().pool == this && "spawn() outside TaskPool::run()");
+        auto* task = new Closure<std::decay_t<F>>(group, std::forward<F>(f));
+        group.pending_.fetch_add(1, std::memory_order_relaxed);
+        workers_[current().index]->deque.push(task);
+        // Pairs with the fence in park(): either a parking worker sees the
+        // task, or we see it in sleepers_ and wake it.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers_.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lk(m_);
+            work_cv_.notify_one();
+        }
+    }
+
+    /** @brief Runs tasks until every task of @p group has finished. */
+    void wait(TaskGroup& group)
+    {
+        assert(current().pool == this && "wait() outside TaskPool::run()");
+        const unsigned self = current().index;
+        while (!group.done()) {
+            if (!run_one(self)) std::this_thread::yield();
+        }
+    }
+
+private:
+    /// Failed steal passes (each followed by a yield) before a worker parks.
+    static constexpr unsigned kSpinSteals = 64;
+
+    struct Task {
+        void (*invoke)(Task*);                 ///< Runs and frees the task
+        TaskGroup* group;
+    };
+
+    template<class F>
+    struct Closure : Task {
+        Closure(TaskGroup& g, F f) : Task{ &call, &g }, fn(std::move(f)) {}
+
+        static void call(Task* t)
+        {
+            std::unique_ptr<Closure> self(static_cast<Closure*>(t));
+            self->fn();
+        }
+
+        F fn;
+    };
+
+    struct alignas(ring_queue_detail::kCacheLine) Worker {
+        WorkStealingDeque<Task*> deque{256};
+        std::uint64_t rng = 0x9e3779b97f4a7c15ull;    ///< Victim selection
+    };
+
+    struct Context {
+        TaskPool* pool = nullptr;
+        unsigned index = 0;
+    };
+
+    static Context& current() noexcept
+    {
+        static thread_local Context ctx;
+        return ctx;
+    }
+
+    // Own deque first (newest task, hot in cache), then one pass over the
+    // others starting at a random victim.
+    bool run_one(unsigned self)
+    {
+        std::optional<Task*> task = workers_[self]->deque.take();
+        if (!task) task = steal(self);
+        if (!task) return false;
+        TaskGroup* group = (*task)->group;
+        (*task)->invoke(*task);
+        group->pending_.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    std::optional<Task*> steal(unsigned self)
+    {
+        const unsigned n = size();
+        if (n == 1) return std::nullopt;
+        std::uint64_t& x = workers_[self]->rng;        // xorshift64
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        const unsigned start = unsigned(x % n);
+        for (unsigned k = 0; k < n; ++k) {
+            const unsigned victim = (start + k) % n;
+            if (victim == self) continue;
+            if (std::optional<Task*> t = workers_[victim]->deque.steal()) return t;
+        }
+        return std::nullopt;
+    }
+
+    void background(unsigned self)
+    {
+        current() = Context{ this, self };
+        workers_[self]->rng += self;
+        std::unique_lock<std::mutex> lk(m_);
+        for (;;) {
+            cv_.wait(lk, [this] { return stop_ || active_.load(std::memory_order_relaxed); });
+            if (stop_) return;
+            lk.unlock();
+            unsigned misses = 0;
+            while (active_.load(std::memory_order_relaxed)) {
+                if (run_one(self)) {
+                    misses = 0;
+                } else if (++misses < kSpinSteals) {
+                    std::this_thread::yield();
+                } else {
+                    park();
+                    misses = 0;
+                }
+            }
+            lk.lock();
+        }
+    }
+
+    // Sleeps until some deque holds a task or the run ends. The sleeper
+    // count goes up before the deques are checked, and spawn() pushes
+    // before it reads the count, with a seq_cst fence on both sides, so a
+    // task is never left behind a sleeping worker.
+    void park()
+    {
+        std::unique_lock<std::mutex> lk(m_);
+        sleepers_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        work_cv_.wait(lk, [this] {
+            if (!active_.load(std::memory_order_relaxed)) return true;
+            for (const auto& w : workers_)
+                if (!w->deque.empty()) return true;
+            return false;
+        });
+        sleepers_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    std::vector<std::unique_ptr<Worker>> workers_;   ///< [0] belongs to run()'s caller
+    std::vector<std::thread> threads_;
+    std::mutex m_;
+    std::condition_variable cv_;                     ///< Wakes workers for a run()
+    std::condition_variable work_cv_;                ///< Wakes parked workers
+    std::atomic<bool> active_{false};                ///< A run() is in progress
+    std::atomic<unsigned> sleepers_{0};              ///< Workers in park()
+    bool stop_ = false;
+};
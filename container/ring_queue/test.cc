@@ -1,12 +1,22 @@
 #include "ring_queue.hh"
 #include <deque>
+#include <vector>
 #include <cassert>
+#include <iterator>
+#include <numeric>
+#include <algorithm>
 #include <iostream>
 #include <random>
+#include <cstdio>
+#include <cstddef>
+#include <stdexcept>
+#include <memory_resource>
 #include <sstream>
 #include <type_traits>
 #include <utility>
 
+#include <unistd.h>
+
 /*======================================================================
  *  Test element types
  *====================================================================*/
@@ -161,6 +171,29 @@ bool check_ring_queue(
         }
     }
 
+    // -----------------------------------------------------------------
+    // Full contents: operator[], iterators and segments()
+    // -----------------------------------------------------------------
+    for (std::size_t k = 0; k < golden.size(); ++k) {
+        if (!(rq[k] == golden[k])) {
+            std::cerr << "operator[] MISMATCH at iteration " << iteration
+                      << ", index " << k << "\n";
+            return false;
+        }
+    }
+    if (!std::equal(rq.begin(), rq.end(), golden.begin(), golden.end())) {
+        std::cerr << "ITERATOR MISMATCH at iteration " << iteration << "\n";
+        return false;
+    }
+    const auto [seg0, seg1] = rq.segments();
+    if (seg0.size() + seg1.size() != golden.size()
+        || !std::equal(seg0.begin(), seg0.end(), golden.begin())
+        || !std::equal(seg1.begin(), seg1.end(), golden.begin() + seg0.size())
+        || (seg1.size() && seg1.data() + rq.capacity() != seg0.end())) {
+        std::cerr << "SEGMENTS MISMATCH at iteration " << iteration << "\n";
+        return false;
+    }
+
     return true;
 }
 
@@ -215,6 +248,65 @@ void sync_pop(RingQueue<T>& rq, std::deque<T>& dq)
     dq.pop_front();
 }
 
+/**
+ * @brief Bulk-append @p k equal values to *both* containers via push_n.
+ *
+ * Uses the `T*` range (memcpy fast path for trivially copyable `T`) when
+ * `T` is copyable, otherwise a move_iterator range.
+ */
+template<class T>
+void sync_push_n(RingQueue<T>& rq, std::deque<T>& dq, std::size_t k, int64_t val)
+{
+    std::vector<T> src;
+    src.reserve(k);
+    for (std::size_t j = 0; j < k; ++j) {
+        src.emplace_back(val + int64_t(j));
+        dq.emplace_back(val + int64_t(j));
+    }
+    if constexpr (std::is_copy_constructible_v<T>) {
+        rq.push_n(src.data(), src.data() + k);
+    } else {
+        rq.push_n(std::make_move_iterator(src.begin()), std::make_move_iterator(src.end()));
+    }
+}
+
+/**
+ * @brief Bulk-pop up to @p k elements from *both* containers.
+ *
+ * @return `false` if the popped values differ from the golden model.
+ */
+template<class T>
+bool sync_pop_n(RingQueue<T>& rq, std::deque<T>& dq, std::size_t k)
+{
+    std::vector<T> out(k);
+    const std::size_t n = rq.pop_n(out.data(), k);
+    if (n != std::min(k, dq.size())) return false;
+    for (std::size_t j = 0; j < n; ++j) {
+        if (!(out[j] == dq.front())) return false;
+        dq.pop_front();
+    }
+    return true;
+}
+
+/**
+ * @brief Drain RingQueue through its span callback and compare with and
+ *        clear the golden model.
+ */
+template<class T>
+bool sync_drain(RingQueue<T>& rq, std::deque<T>& dq)
+{
+    std::size_t seen = 0, calls = 0;
+    bool ok = true;
+    rq.drain([&](T* run, std::size_t len) {
+        ++calls;
+        for (std::size_t j = 0; j < len; ++j, ++seen)
+            ok = ok && (run[j] == dq[seen]);
+    });
+    ok = ok && seen == dq.size() && calls <= 2;
+    dq.clear();
+    return ok;
+}
+
 /**
  * @brief Stress-test RingQueue against std::deque with random operations.
  *
@@ -223,13 +315,13 @@ void sync_pop(RingQueue<T>& rq, std::deque<T>& dq)
  * @param seed           Random seed (default = 42). Printed to stdout.
  */
 template<class T, std::size_t Iterations = 100'000>
-void stress_test_ring_queue(std::mt19937::result_type seed = 42)
+bool stress_test_ring_queue(std::mt19937::result_type seed = 42)
 {
     RingQueue<T> rq;
     std::deque<T> dq;
 
     std::mt19937 rng(seed);
-    std::uniform_int_distribution<int> op_dist(0, 4);        // 0..4 → 5 choices
+    std::uniform_int_distribution<int> op_dist(0, 14);       // 0..14 → 15 choices
     std::uniform_int_distribution<int64_t> val_dist(INT64_MIN, INT64_MAX);     // payload values
 
     // -----------------------------------------------------------------
@@ -237,7 +329,7 @@ void stress_test_ring_queue(std::mt19937::result_type seed = 42)
     // -----------------------------------------------------------------
     if (not check_ring_queue(rq, dq, -1)) {
         std::cerr << "Error after initialization." << std::endl;
-        return;
+        return false;
     }
     std::cout << "=== RingQueue stress test ===\n"
               << "Element type: " << typeid(T).name() << "\n"
@@ -285,14 +377,530 @@ void stress_test_ring_queue(std::mt19937::result_type seed = 42)
                 rq.reserve(new_cap);
                 break;
             }
+
+            case 5: // move out and back (RingQueue only)
+            {
+                ss << "Move" << std::endl;
+                RingQueue<T> tmp(std::move(rq));
+                rq = std::move(tmp);
+                break;
+            }
+
+            case 6: // clear – rare, so the queue still gets deep
+                if (val % 64 != 0) break;
+                ss << "Clear" << std::endl;
+                rq.clear();
+                dq.clear();
+                break;
+
+            case 7: // push_n
+            {
+                const std::size_t k = std::size_t(val) % 40;
+                ss << "PushN " << k << std::endl;
+                sync_push_n(rq, dq, k, val);
+                break;
+            }
+
+            case 8: // pop_n
+            {
+                const std::size_t k = std::size_t(val) % 40;
+                ss << "PopN " << k << std::endl;
+                if (!sync_pop_n(rq, dq, k)) {
+                    std::cerr << "POP_N MISMATCH at iteration " << i << "\n"
+                              << "Error after " << ss.str();
+                    return false;
+                }
+                break;
+            }
+
+            case 9: // drain – rare, like clear
+                if (val % 64 != 0) break;
+                ss << "Drain" << std::endl;
+                if (!sync_drain(rq, dq)) {
+                    std::cerr << "DRAIN MISMATCH at iteration " << i << "\n"
+                              << "Error after " << ss.str();
+                    return false;
+                }
+                break;
+
+            case 10: // push_front
+                ss << "PushFront " << val << std::endl;
+                rq.push_front(T(val));
+                dq.push_front(T(val));
+                break;
+
+            case 11: // emplace_front
+                ss << "EmplaceFront " << val << std::endl;
+                rq.emplace_front(val);
+                dq.emplace_front(val);
+                break;
+
+            case 12: // pop_back
+                if (rq.empty()) break;
+                ss << "PopBack" << std::endl;
+                rq.pop_back();
+                dq.pop_back();
+                break;
+
+            case 13: // truncate_back (squash)
+            {
+                const std::size_t k = std::size_t(val) % (dq.size() / 2 + 1);
+                ss << "TruncateBack " << k << std::endl;
+                rq.truncate_back(k);
+                dq.erase(dq.end() - std::ptrdiff_t(k), dq.end());
+                break;
+            }
+
+            case 14: // truncate_front (bulk retire)
+            {
+                const std::size_t k = std::size_t(val) % (dq.size() / 2 + 1);
+                ss << "TruncateFront " << k << std::endl;
+                rq.truncate_front(k);
+                dq.erase(dq.begin(), dq.begin() + std::ptrdiff_t(k));
+                break;
+            }
         }
         if (not check_ring_queue(rq, dq, i)) {
             std::cerr << "Error after " << ss.str();
-            return;
+            return false;
         }
     }
 
     std::cout << "All " << Iterations << " operations passed!\n";
+    return true;
+}
+
+/*======================================================================
+ *  Object lifetime: every constructed element is destroyed exactly once
+ *====================================================================*/
+
+/** Counts live instances; has no default constructor on purpose. */
+struct Tracked {
+    static inline long live = 0;
+    long v;
+
+    explicit Tracked(long x) : v(x) { ++live; }
+    Tracked(const Tracked& o) : v(o.v) { ++live; }
+    Tracked(Tracked&& o) noexcept : v(o.v) { ++live; }
+    Tracked& operator=(const Tracked&) = default;
+    ~Tracked() { --live; }
+};
+
+/** Output iterator that throws once @p budget elements have been stored. */
+struct ThrowingOutput {
+    std::vector<Tracked>* dst;
+    std::size_t budget;
+
+    ThrowingOutput& operator*() { return *this; }
+    ThrowingOutput& operator++() { return *this; }
+    ThrowingOutput& operator=(Tracked&& t)
+    {
+        if (dst->size() == budget) throw std::bad_alloc();
+        dst->push_back(std::move(t));
+        return *this;
+    }
+};
+
+bool test_lifetime()
+{
+    {
+        RingQueue<Tracked> rq(4);
+        for (long i = 0; i < 1000; ++i) {
+            rq.emplace(i);
+            if (i % 3 == 0) rq.pop();
+            if (i % 5 == 0) rq.emplace_front(-i);
+            if (i % 7 == 0) rq.pop_back();
+        }
+        rq.truncate_back(100);
+        rq.truncate_front(50);
+        rq.reserve(4096);
+        RingQueue<Tracked> copy(rq);
+        while (rq.size() > 10) rq.pop();
+        rq.shrink_to_fit();
+        copy = rq;
+        if (Tracked::live != long(rq.size() + copy.size())) {
+            std::cerr << "LIFETIME MISMATCH: " << Tracked::live << " live, "
+                      << rq.size() + copy.size() << " stored\n";
+            return false;
+        }
+        while (!copy.empty()) {
+            if (copy.front().v != rq.front().v) return false;
+            copy.pop();
+            Tracked t = rq.front();
+            rq.pop();
+            rq.push(t);
+        }
+
+        // pop_n into an output that throws midway, across the wrap point:
+        // the elements handed over are gone, the rest are still queued.
+        RingQueue<Tracked> wrapped(8);
+        for (long i = 0; i < 6; ++i) wrapped.emplace(i);
+        for (long i = 0; i < 6; ++i) wrapped.pop();
+        for (long i = 0; i < 6; ++i) wrapped.emplace(i);
+        std::vector<Tracked> out;
+        out.reserve(8);
+        bool threw = false;
+        try { wrapped.pop_n(ThrowingOutput{ &out, 4 }, 6); } catch (const std::bad_alloc&) { threw = true; }
+        if (!threw || out.size() != 4 || wrapped.size() != 2 || wrapped.front().v != 4
+            || Tracked::live != long(rq.size() + wrapped.size() + out.size())) {
+            std::cerr << "pop_n NOT EXCEPTION SAFE: " << Tracked::live << " live\n";
+            return false;
+        }
+
+        // Copying a moved-from queue allocates nothing; the copy grows on push.
+        RingQueue<Tracked> gone(std::move(wrapped));
+        RingQueue<Tracked> from_gone(wrapped);
+        RingQueue<long> ints(4), ints_gone(std::move(ints));
+        RingQueue<long> ints_copy(ints);
+        if (from_gone.capacity() != 0 || ints_copy.capacity() != 0) return false;
+        from_gone.emplace(7);
+        ints_copy.push(7);
+        if (from_gone.front().v != 7 || ints_copy.front() != 7) return false;
+    }
+    if (Tracked::live != 0) {
+        std::cerr << "LIFETIME LEAK: " << Tracked::live << " objects alive\n";
+        return false;
+    }
+    std::cout << "Lifetime test passed!\n";
+    return true;
+}
+
+/*======================================================================
+ *  std:: algorithms over a wrapped queue
+ *====================================================================*/
+
+bool test_iterators(std::mt19937::result_type seed)
+{
+    std::mt19937 rng(seed);
+    RingQueue<long> rq(64);
+    std::vector<long> golden;
+
+    // Advance head past the middle so the contents wrap.
+    for (int i = 0; i < 40; ++i) rq.push(0);
+    for (int i = 0; i < 40; ++i) rq.pop();
+    for (int i = 0; i < 50; ++i) {
+        const long v = long(rng() % 1000);
+        rq.push(v);
+        golden.push_back(v);
+    }
+    if (rq.segments().second.empty()) return false;   // must wrap
+
+    std::sort(rq.begin(), rq.end());
+    std::sort(golden.begin(), golden.end());
+    if (!std::equal(rq.begin(), rq.end(), golden.begin(), golden.end())) return false;
+
+    const RingQueue<long>& crq = rq;
+    RingQueue<long>::const_iterator it = rq.begin();  // iterator → const_iterator
+    if (it != crq.cbegin() || crq.end() - crq.begin() != 50) return false;
+    if (*std::lower_bound(crq.begin(), crq.end(), golden[25]) != golden[25]) return false;
+    if (crq.begin()[49] != golden[49] || *(crq.end() - 1) != golden.back()) return false;
+
+    std::reverse(rq.begin(), rq.end());
+    std::reverse(golden.begin(), golden.end());
+    for (std::size_t k = 0; k < golden.size(); ++k)
+        if (rq[k] != golden[k]) return false;
+
+    long sum = 0;
+    const auto [a, b] = crq.segments();
+    for (long v : a) sum += v;
+    for (long v : b) sum += v;
+    if (sum != std::accumulate(golden.begin(), golden.end(), 0L)) return false;
+
+    std::cout << "Iterator test passed!\n";
+    return true;
+}
+
+/*======================================================================
+ *  Growth of a full, wrapped queue at every head offset
+ *
+ *  Covers both unwrap directions of the relocating (trivially copyable)
+ *  path as well as the element-wise path.
+ *====================================================================*/
+
+inline long as_long(long v) { return v; }
+inline long as_long(const Tracked& t) { return t.v; }
+
+template<class T>
+bool test_wrapped_growth()
+{
+    constexpr std::size_t kCap = 16;
+    for (std::size_t offset = 0; offset < kCap; ++offset) {
+        RingQueue<T> rq(kCap);
+        for (std::size_t i = 0; i < offset; ++i) rq.push(T(0));
+        for (std::size_t i = 0; i < offset; ++i) rq.pop();
+        for (std::size_t i = 0; i < kCap + 1; ++i) rq.push(T(long(i)));   // grows when full
+        for (std::size_t i = 0; i < 3 * kCap; ++i) rq.push(T(long(kCap + 1 + i)));
+        for (std::size_t i = 0; i < rq.size(); ++i)
+            if (as_long(rq[i]) != long(i)) return false;
+        rq.shrink_to_fit();                           // not sparse – no-op
+        while (rq.size() > 3) rq.pop();
+        rq.shrink_to_fit();                           // relocates to 16 slots
+        if (rq.capacity() != 16 || as_long(rq.front()) != long(4 * kCap - 2)) return false;
+    }
+    return true;
+}
+
+/*======================================================================
+ *  Allocators: a stateful counting allocator and std::pmr
+ *====================================================================*/
+
+/** Stateful allocator that tallies live bytes in a shared counter. */
+template<class T>
+struct CountingAlloc {
+    using value_type = T;
+    long* live;
+
+    explicit CountingAlloc(long* counter) noexcept : live(counter) {}
+    template<class U>
+    CountingAlloc(const CountingAlloc<U>& o) noexcept : live(o.live) {}
+
+    T* allocate(std::size_t n)
+    {
+        *live += long(n * sizeof(T));
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        *live -= long(n * sizeof(T));
+        std::allocator<T>().deallocate(p, n);
+    }
+    friend bool operator==(const CountingAlloc& a, const CountingAlloc& b) { return a.live == b.live; }
+    friend bool operator!=(const CountingAlloc& a, const CountingAlloc& b) { return a.live != b.live; }
+};
+
+bool test_allocators()
+{
+    // Every byte handed out through the allocator comes back, across
+    // growth, shrink, copy and both kinds of move assignment.
+    long live_a = 0, live_b = 0;
+    {
+        using Q = RingQueue<Tracked, CountingAlloc<Tracked>>;
+        Q a(4, CountingAlloc<Tracked>(&live_a));
+        for (long i = 0; i < 1000; ++i) a.emplace(i);
+        if (live_a != long(a.capacity() * sizeof(Tracked))) return false;
+        while (a.size() > 10) a.pop();
+        a.shrink_to_fit();
+
+        Q b(8, CountingAlloc<Tracked>(&live_b));
+        b = a;                                       // copy: keeps b's allocator
+        if (b.get_allocator().live != &live_b || b.front().v != a.front().v) return false;
+        Q c(a);
+        c = std::move(b);                            // unequal: element-wise
+        if (c.get_allocator().live != &live_a || c.size() != 10 || !b.empty()) return false;
+        Q d(std::move(c));                           // steals buffer + allocator
+        if (d.size() != 10 || d.back().v != 999) return false;
+    }
+    if (live_a != 0 || live_b != 0 || Tracked::live != 0) {
+        std::cerr << "ALLOCATOR LEAK: " << live_a << " / " << live_b << " bytes\n";
+        return false;
+    }
+
+    // A pmr queue draws its buffer from the arena; null upstream means any
+    // stray allocation would throw.
+    std::vector<std::byte> buf(1 << 16);
+    std::pmr::monotonic_buffer_resource arena(buf.data(), buf.size(),
+                                              std::pmr::null_memory_resource());
+    RingQueue<long, std::pmr::polymorphic_allocator<long>> pq(4, &arena);
+    for (long i = 0; i < 1000; ++i) pq.push(i);
+    for (long i = 0; i < 500; ++i) pq.pop();
+    pq.push_front(499);
+    if (pq.front() != 499 || pq.back() != 999 || pq.get_allocator().resource() != &arena)
+        return false;
+
+    // polymorphic_allocator never propagates: assignment copies / moves the
+    // elements into storage from the target's own resource, and a move
+    // between queues on one resource steals the buffer.
+    std::pmr::unsynchronized_pool_resource other_arena;
+    using PQ = RingQueue<long, std::pmr::polymorphic_allocator<long>>;
+    PQ copy(8, &other_arena), moved(8, &other_arena), same(8, &arena);
+    copy = pq;
+    moved = std::move(pq);
+    if (copy.get_allocator().resource() != &other_arena || copy.size() != 501 || copy.front() != 499
+        || moved.get_allocator().resource() != &other_arena || moved.size() != 501
+        || moved.back() != 999 || !pq.empty() || pq.get_allocator().resource() != &arena)
+        return false;
+    pq = copy;                                       // back into the arena
+    same = std::move(pq);                            // equal resources: steals
+    if (same.get_allocator().resource() != &arena || same.size() != 501 || same.back() != 999
+        || !pq.empty())
+        return false;
+
+    std::cout << "Allocator test passed!\n";
+    return true;
+}
+
+/*======================================================================
+ *  Growth policy: factor / step / minimum capacity / hysteresis shrink
+ *====================================================================*/
+
+bool test_growth_policy(std::mt19937::result_type seed)
+{
+    using Policy = RingGrowthPolicy<4, 64, 16, 8>;
+    RingQueue<long, std::allocator<long>, Policy> rq(1);
+    std::deque<long> dq;
+    std::mt19937 rng(seed);
+
+    if (rq.capacity() != 16) return false;                // raised to MinCapacity
+    for (long i = 0; i < 17; ++i) rq.push(i);
+    if (rq.capacity() != 128) return false;               // max(16*4, 16+64) → 128
+    while (!rq.empty()) rq.pop();
+    if (rq.capacity() != 16) return false;                // shrunk, but not below 16
+
+    // Bursty trace: the queue must match the golden model, and after any
+    // pop it is either at the floor or at least 1/8 full.
+    std::size_t resizes = 0;
+    for (int burst = 0; burst < 40; ++burst) {
+        const std::size_t hi = 1 + rng() % 20'000, lo = rng() % 16;
+        while (dq.size() < hi) {
+            const long v = long(rng());
+            rq.push(v);
+            dq.push_back(v);
+        }
+        while (dq.size() > lo) {
+            const std::size_t cap = rq.capacity();
+            if (rq.front() != dq.front()) return false;
+            if (rng() % 4) {
+                rq.pop();
+                dq.pop_front();
+            } else {
+                rq.pop_back();
+                dq.pop_back();
+            }
+            resizes += rq.capacity() != cap;
+            if (rq.capacity() > 16 && rq.size() * 8 < rq.capacity()) return false;
+        }
+        if (!std::equal(rq.begin(), rq.end(), dq.begin(), dq.end())) return false;
+    }
+    if (resizes == 0) return false;
+
+    // shrink_to_fit() respects a MinCapacity above its own floor of 16.
+    RingQueue<long, std::allocator<long>, RingGrowthPolicy<2, 0, 1024>> big(1);
+    for (long i = 0; i < 8192; ++i) big.push(i);
+    while (big.size() > 10) big.pop();
+    big.shrink_to_fit();
+    if (big.capacity() != 1024 || big.front() != 8182) return false;
+    big.shrink_to_fit();                                  // already at the floor
+    if (big.capacity() != 1024) return false;
+
+    std::cout << "Growth policy test passed!\n";
+    return true;
+}
+
+/*======================================================================
+ *  Instrumentation policy
+ *====================================================================*/
+
+// Disabled stats must not change the layout.
+static_assert(sizeof(RingQueue<long>) == 5 * sizeof(std::size_t), "RingStatsOff must take no space");
+
+bool test_stats()
+{
+    CountingRingQueue<Tracked> rq(4);
+    for (long i = 0; i < 100; ++i) rq.emplace(i);             // 4 → 128: 5 grows
+    for (int i = 0; i < 90; ++i) rq.pop();
+    rq.emplace_front(-1);
+    std::vector<Tracked> src(5, Tracked(7));
+    rq.push_n(src.begin(), src.end());
+    rq.shrink_to_fit();                                       // 16 < 128/4 → shrink
+
+    const RingQueueStats st = rq.stats();
+    std::size_t hist = 0;
+    for (std::size_t c : st.occupancy) hist += c;
+    if (st.high_water != 100 || st.grow_count != 5 || st.shrink_count != 1
+        || st.pushes != 106 || hist != st.pushes || st.occupancy[6] != 37
+        || st.bytes_moved != (4 + 8 + 16 + 32 + 64 + 16) * sizeof(Tracked)) {
+        st.print(std::cerr << "STATS MISMATCH: ");
+        return false;
+    }
+
+    std::ostringstream os;
+    st.print(os);
+    CountingRingQueue<Tracked> copy(rq);
+    rq.reset_stats();
+    if (os.str().empty() || copy.stats().pushes != 0 || rq.stats().high_water != 0)
+        return false;
+
+    std::cout << "Stats test passed!\n";
+    return true;
+}
+
+/*======================================================================
+ *  Checkpoint / restore
+ *====================================================================*/
+
+template<class Q>
+bool same_contents(const Q& a, const Q& b)
+{
+    return a.size() == b.size() && a.capacity() == b.capacity()
+        && std::equal(a.begin(), a.end(), b.begin());
+}
+
+bool test_checkpoint()
+{
+    // Wrapped contents, so the payload is written as two runs.
+    RingQueue<long> rq(64);
+    for (long i = 0; i < 50; ++i) rq.push(i);
+    for (int i = 0; i < 40; ++i) rq.pop();
+    for (long i = 50; i < 100; ++i) rq.push(i);
+    if (rq.segments().second.empty()) return false;
+
+    std::stringstream ss;
+    rq.serialize(ss);
+    RingQueue<long> back(4);
+    back.push(-1);
+    back.unserialize(ss);
+    if (!same_contents(rq, back)) return false;
+    back.push(100);                            // restored indices are usable
+    if (back.back() != 100 || back.front() != 40) return false;
+
+    // Empty and storage-less queues round-trip too.
+    RingQueue<long> empty;
+    empty.shrink_to_fit();
+    std::stringstream es;
+    empty.serialize(es);
+    back.unserialize(es);
+    if (!back.empty()) return false;
+
+    // File descriptor path; a pmr queue takes the non-relocating branch.
+    std::FILE* f = std::tmpfile();
+    if (!f) return false;
+    rq.serialize(fileno(f));
+    ::lseek(fileno(f), 0, SEEK_SET);
+    std::pmr::monotonic_buffer_resource arena;
+    RingQueue<long, std::pmr::polymorphic_allocator<long>> pq(2, &arena);
+    pq.unserialize(fileno(f));
+    std::fclose(f);
+    if (pq.size() != rq.size() || !std::equal(rq.begin(), rq.end(), pq.begin()))
+        return false;
+
+    // Bad input throws and leaves the queue as it was.
+    const std::string bytes = ss.str();
+    const auto rejects = [&](const std::string& input) {
+        std::istringstream in(input);
+        try {
+            back.unserialize(in);
+        } catch (const std::runtime_error&) {
+            return same_contents(back, rq);
+        }
+        return false;
+    };
+    back = rq;
+    if (!rejects(bytes.substr(0, 16)) || !rejects(bytes.substr(0, bytes.size() - 1))
+        || !rejects("not a checkpoint, just text...................."))
+        return false;
+
+    std::stringstream ws;
+    RingQueue<int> narrow;
+    narrow.push(1);
+    narrow.serialize(ws);
+    try {
+        back.unserialize(ws);
+        return false;
+    } catch (const std::runtime_error&) {
+    }
+
+    std::cout << "Checkpoint test passed!\n";
+    return true;
 }
 
 // ---------------------------------------------------------------------
@@ -331,14 +939,61 @@ int main(int argc, char* argv[])
     //  Test 1: Trivial type (long)
     // -----------------------------------------------------------------
     std::cout << "Test 1: Element = long\n";
-    stress_test_ring_queue<long, kIterations>(seed);
+    bool ok = stress_test_ring_queue<long, kIterations>(seed);
 
     // -----------------------------------------------------------------
     //  Test 2: Non-trivial, move-only (Packet)
     // -----------------------------------------------------------------
     std::cout << "\nTest 2: Element = Packet (move-only, auto-ID)\n";
-    stress_test_ring_queue<Packet, kIterations>(seed);
+    ok = stress_test_ring_queue<Packet, kIterations>(seed) && ok;
 
+    // -----------------------------------------------------------------
+    //  Test 3: Construction / destruction balance
+    // -----------------------------------------------------------------
+    std::cout << "\nTest 3: Element = Tracked (instance counting)\n";
+    ok = test_lifetime() && ok;
+
+    // -----------------------------------------------------------------
+    //  Test 4: Random-access iterators / segments with std:: algorithms
+    // -----------------------------------------------------------------
+    std::cout << "\nTest 4: Iterators and segments\n";
+    ok = test_iterators(seed) && ok;
+
+    // -----------------------------------------------------------------
+    //  Test 5: Growth / shrink of a wrapped queue (relocating and not)
+    // -----------------------------------------------------------------
+    std::cout << "\nTest 5: Wrapped growth\n";
+    ok = test_wrapped_growth<long>() && test_wrapped_growth<Tracked>() && ok;
+    std::cout << (ok ? "Wrapped growth test passed!\n" : "Wrapped growth test FAILED\n");
+
+    // -----------------------------------------------------------------
+    //  Test 6: Stateful allocator and std::pmr storage
+    // -----------------------------------------------------------------
+    std::cout << "\nTest 6: Allocators\n";
+    ok = test_allocators() && ok;
+
+    // -----------------------------------------------------------------
+    //  Test 7: Growth policy with automatic shrink
+    // -----------------------------------------------------------------
+    std::cout << "\nTest 7: Growth policy\n";
+    ok = test_growth_policy(seed) && ok;
+
+    // -----------------------------------------------------------------
+    //  Test 8: Instrumentation counters
+    // -----------------------------------------------------------------
+    std::cout << "\nTest 8: Stats\n";
+    ok = test_stats() && ok;
+
+    // -----------------------------------------------------------------
+    //  Test 9: Checkpoint / restore round trips
+    // -----------------------------------------------------------------
+    std::cout << "\nTest 9: Checkpoint\n";
+    ok = test_checkpoint() && ok;
+
+    if (!ok) {
+        std::cerr << "\nTests FAILED (seed " << seed << ")\n";
+        return 1;
+    }
     std::cout << "\nAll tests passed!\n";
     return 0;
 }
@@ -0,0 +1,162 @@
+// container/ring_queue/test_blocking.cc
+// Correctness test for BlockingRingQueue: non-blocking golden model,
+// blocking producers / consumers on tiny capacities (so both sides park),
+// and close() releasing parked threads.
+
+#include "blocking_ring_queue.hh"
+#include <deque>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <random>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+/*======================================================================
+ *  Single-threaded: try_push / try_pop vs std::deque
+ *====================================================================*/
+
+void stress_single_thread(std::mt19937::result_type seed)
+{
+    BlockingRingQueue<long> q(64);
+    std::deque<long> dq;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> op_dist(0, 2);
+
+    for (long i = 0; i < 200'000; ++i) {
+        if (op_dist(rng) < 2) {
+            const bool ok = q.try_push(i);
+            assert(ok == (dq.size() < q.capacity()) && "try_push full mismatch");
+            if (ok) dq.push_back(i);
+        } else {
+            long out = -1;
+            const bool ok = q.try_pop(out);
+            assert(ok == !dq.empty() && "try_pop empty mismatch");
+            if (ok) {
+                assert(out == dq.front() && "try_pop value mismatch");
+                dq.pop_front();
+            }
+        }
+        assert(q.size() == dq.size() && "size mismatch");
+    }
+    std::cout << "  single-thread: passed\n";
+}
+
+/*======================================================================
+ *  P producers × C consumers, blocking push / pop
+ *
+ *  Producers close the queue when the last one finishes; consumers pop
+ *  until pop() reports closed-and-empty. Per-producer order and the
+ *  checksum must hold, and no element may be lost at shutdown.
+ *====================================================================*/
+
+void stress_threads(unsigned producers, unsigned consumers,
+                    std::uint64_t per_producer, std::size_t cap)
+{
+    BlockingRingQueue<std::uint64_t> q(cap);
+    std::atomic<std::uint64_t> sum{0};
+    std::atomic<std::uint64_t> popped{0};
+    std::atomic<unsigned> running{producers};
+    std::atomic<bool> order_ok{true};
+
+    std::vector<std::thread> threads;
+    for (unsigned c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            std::vector<std::int64_t> last(producers, -1);
+            std::uint64_t local_sum = 0, local_n = 0, v;
+            while (q.pop(v)) {
+                const auto p = v >> 32;
+                const auto s = std::int64_t(v & 0xffffffffu);
+                if (s <= last[p]) order_ok = false;
+                last[p] = s;
+                local_sum += v;
+                ++local_n;
+            }
+            sum += local_sum;
+            popped += local_n;
+        });
+    }
+    for (unsigned p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (std::uint64_t s = 0; s < per_producer; ++s) {
+                const bool ok = q.push((std::uint64_t(p) << 32) | s);
+                assert(ok && "push on an open queue failed");
+            }
+            if (running.fetch_sub(1) == 1) q.close();
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    std::uint64_t expect = 0;
+    for (unsigned p = 0; p < producers; ++p)
+        expect += (std::uint64_t(p) << 32) * per_producer + per_producer * (per_producer - 1) / 2;
+
+    assert(order_ok && "per-producer order violated");
+    assert(popped == per_producer * producers && "elements lost at close()");
+    assert(sum == expect && "checksum mismatch");
+    assert(q.empty() && "queue not drained");
+    std::cout << "  " << producers << "P x " << consumers << "C, cap " << q.capacity()
+              << ": passed\n";
+}
+
+/*======================================================================
+ *  close() wakes parked threads on both sides
+ *====================================================================*/
+
+void test_close()
+{
+    using namespace std::chrono_literals;
+
+    {   // consumers parked on an empty queue
+        BlockingRingQueue<int> q(4);
+        std::atomic<int> failed{0};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 3; ++i)
+            threads.emplace_back([&] { int v; if (!q.pop(v)) ++failed; });
+        std::this_thread::sleep_for(20ms);
+        q.close();
+        for (auto& t : threads) t.join();
+        assert(failed == 3 && "pop() on a closed, empty queue succeeded");
+    }
+    {   // a producer parked on a full queue
+        BlockingRingQueue<int> q(2);
+        while (q.try_push(0)) {}
+        std::atomic<bool> result{true};
+        std::thread t([&] { result = q.push(1); });
+        std::this_thread::sleep_for(20ms);
+        q.close();
+        t.join();
+        assert(!result && "push() on a closed queue succeeded");
+
+        int v;                                   // queued elements survive close()
+        std::size_t n = 0;
+        while (q.pop(v)) ++n;
+        assert(n == q.capacity() && "close() dropped queued elements");
+        const bool pushed = q.try_push(2);
+        assert(!pushed && "try_push() on a closed queue succeeded");
+    }
+    std::cout << "  close: passed\n";
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== BlockingRingQueue Test (seed " << seed << ") ===\n\n";
+
+    stress_single_thread(seed);
+    stress_threads(1, 1, 200'000, 64);
+    stress_threads(4, 1, 50'000, 64);
+    stress_threads(1, 4, 200'000, 64);
+    stress_threads(4, 4, 50'000, 2);
+    stress_threads(8, 8, 10'000, 2);
+    test_close();
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
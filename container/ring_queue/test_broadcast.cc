@@ -0,0 +1,161 @@
+// container/ring_queue/test_broadcast.cc
+// Correctness test for BroadcastRingQueue (one std::deque per consumer as
+// golden model, growth while consumers lag, element lifetimes) and for
+// SpmcBroadcastRingQueue (every consumer thread sees every element, in
+// order, through a tiny ring).
+
+#include "broadcast_ring_queue.hh"
+#include <deque>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <random>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+/*======================================================================
+ *  Single-threaded: random push / consume vs a deque per consumer
+ *====================================================================*/
+
+bool check_consumer(const BroadcastRingQueue<std::string>& q, std::size_t c,
+                    const std::deque<std::string>& golden, std::size_t iteration)
+{
+    const auto [a, b] = q.segments(c);
+    if (q.available(c) != golden.size() || a.size() + b.size() != golden.size()) {
+        std::cerr << "AVAILABLE MISMATCH at iteration " << iteration << ", consumer " << c
+                  << "  Expected: " << golden.size() << "  Actual: " << q.available(c) << "\n";
+        return false;
+    }
+    std::size_t k = 0;
+    for (const auto& v : a) if (v != golden[k++]) return false;
+    for (const auto& v : b) if (v != golden[k++]) return false;
+    return golden.empty() || q.front(c) == golden.front();
+}
+
+template<std::size_t Iterations = 200'000>
+bool stress_test(std::mt19937::result_type seed)
+{
+    BroadcastRingQueue<std::string> q(3, 2);
+    std::vector<std::deque<std::string>> golden(3);
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> op_dist(0, 99);
+
+    for (std::size_t i = 0; i < Iterations; ++i) {
+        const int op = op_dist(rng);
+        if (op < 50) {
+            const std::string val = std::to_string(i);
+            q.push(val);
+            for (auto& g : golden) g.push_back(val);
+        } else if (op < 99) {
+            // Consumers drain at different rates; consumer 0 is the laggard.
+            const std::size_t c = rng() % golden.size();
+            const std::size_t n = golden[c].empty() ? 0 : rng() % (golden[c].size() + 1) / (c == 0 ? 4 : 1);
+            if (n == 1 && rng() % 2) q.pop(c); else q.consume(c, n);
+            golden[c].erase(golden[c].begin(), golden[c].begin() + std::ptrdiff_t(n));
+        } else if (golden.size() < 8) {
+            q.add_consumer();
+            golden.emplace_back();
+        }
+
+        std::size_t slowest = 0;
+        for (std::size_t c = 0; c < golden.size(); ++c) {
+            if (!check_consumer(q, c, golden[c], i)) return false;
+            slowest = std::max(slowest, golden[c].size());
+        }
+        if (q.size() != slowest || q.consumers() != golden.size()) {
+            std::cerr << "RETAINED MISMATCH at iteration " << i << "\n";
+            return false;
+        }
+    }
+    std::cout << "  stress: " << Iterations << " ops passed (" << q.consumers()
+              << " consumers, capacity " << q.capacity() << ")\n";
+    return true;
+}
+
+/*======================================================================
+ *  Threads: one producer, C consumers, capacity 8 (the producer waits on
+ *  the slowest consumer all the time)
+ *====================================================================*/
+
+void stress_threads(std::size_t consumers, std::uint64_t n, std::size_t cap)
+{
+    SpmcBroadcastRingQueue<std::uint64_t> q(consumers, cap);
+    std::atomic<bool> order_ok{true};
+
+    std::vector<std::thread> threads;
+    for (std::size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] {
+            std::uint64_t expect = 0;
+            while (expect < n) {
+                const auto [a, b] = q.segments(c);
+                if (a.empty()) { std::this_thread::yield(); continue; }
+                for (std::uint64_t v : a) order_ok = order_ok && v == expect++;
+                for (std::uint64_t v : b) order_ok = order_ok && v == expect++;
+                q.consume(c, a.size() + b.size());
+            }
+        });
+    }
+    for (std::uint64_t i = 0; i < n; ++i) {
+        while (!q.try_push(i)) std::this_thread::yield();
+    }
+    for (auto& t : threads) t.join();
+
+    for (std::size_t c = 0; c < consumers; ++c)
+        assert(q.available(c) == 0 && "consumer left elements behind");
+    assert(order_ok && "a consumer missed, duplicated or reordered an element");
+    std::cout << "  1P x " << consumers << "C, cap " << q.capacity() << ": passed\n";
+}
+
+/*======================================================================
+ *  SpmcBroadcastRingQueue needs no default constructor: slots are raw
+ *  storage until pushed
+ *====================================================================*/
+
+struct Event {
+    explicit Event(std::uint32_t v) : value(v) {}
+    std::uint32_t value;
+};
+
+void test_no_default_ctor()
+{
+    SpmcBroadcastRingQueue<Event> q(2, 4);
+    for (std::uint32_t lap = 0; lap < 3; ++lap) {
+        for (std::uint32_t i = 0; i < 4; ++i) {
+            const bool ok = q.try_push(Event(lap * 4 + i));
+            assert(ok);
+        }
+        const bool full = !q.try_push(Event(0));
+        assert(full && "push past the slowest consumer succeeded");
+        for (std::size_t c = 0; c < 2; ++c) {
+            const auto [a, b] = q.segments(c);
+            assert(a.size() + b.size() == 4 && a[0].value == lap * 4);
+            q.consume(c, 4);
+        }
+        (void)full;
+    }
+    std::cout << "  SPMC without a default constructor: passed\n";
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== BroadcastRingQueue Test (seed " << seed << ") ===\n\n";
+
+    if (!stress_test(seed)) {
+        std::cerr << "\nBroadcastRingQueue test FAILED (seed " << seed << ")\n";
+        return 1;
+    }
+    test_no_default_ctor();
+    stress_threads(1, 500'000, 8);
+    stress_threads(3, 500'000, 8);
+    stress_threads(3, 500'000, 1024);
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,182 @@
+// container/ring_queue/test_byte_ring.cc
+// Correctness test for ByteRingQueue (random reserve / commit / release vs
+// a deque of byte vectors, across padding and growth) and
+// SpscByteRingQueue (two threads, every record arrives intact and in
+// order).
+
+#include "byte_ring_queue.hh"
+#include <deque>
+#include <vector>
+#include <thread>
+#include <random>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <algorithm>
+
+// Payload of record i with length len: recognisable, differs per record.
+static void fill(std::uint8_t* dst, std::size_t len, std::uint64_t i)
+{
+    for (std::size_t k = 0; k < len; ++k) dst[k] = std::uint8_t(i * 131 + k);
+}
+
+static bool matches(RingSpan<const std::uint8_t> rec, std::size_t len, std::uint64_t i)
+{
+    if (rec.size() != len) return false;
+    for (std::size_t k = 0; k < len; ++k)
+        if (rec[k] != std::uint8_t(i * 131 + k)) return false;
+    return true;
+}
+
+/*======================================================================
+ *  Single-threaded: random ops vs std::deque<std::vector<uint8_t>>
+ *====================================================================*/
+
+bool stress_test(std::mt19937::result_type seed, std::size_t init_bytes,
+                 std::size_t Iterations = 200'000)
+{
+    ByteRingQueue q(init_bytes);
+    std::deque<std::vector<std::uint8_t>> dq;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> op_dist(0, 99);
+    std::size_t grows = 0, pads = 0;
+
+    for (std::size_t i = 0; i < Iterations; ++i) {
+        const int op = op_dist(rng);
+        if (op < 50) {
+            // Mostly short records, some as large as the initial buffer.
+            const std::size_t len = rng() % 8 == 0 ? rng() % (init_bytes + 1) : rng() % 48;
+            const std::size_t cap = q.capacity();
+            std::uint8_t* p = q.reserve(len);
+            grows += q.capacity() != cap;
+            const std::size_t n = op < 10 ? rng() % (len + 1) : len;   // commit less
+            std::vector<std::uint8_t> v(n);
+            fill(p, n, i);
+            fill(v.data(), n, i);
+            q.commit(n);
+            dq.push_back(std::move(v));
+        } else if (op < 95) {
+            if (dq.empty()) continue;
+            const auto rec = q.peek();
+            if (rec.size() != dq.front().size()
+                || !std::equal(rec.begin(), rec.end(), dq.front().begin())) {
+                std::cerr << "RECORD MISMATCH at iteration " << i << "\n";
+                return false;
+            }
+            const std::size_t before = q.bytes();
+            q.release();
+            pads += before - q.bytes() > ring_queue_detail::ByteRecord::bytes(rec.size());
+            dq.pop_front();
+        } else {
+            while (!dq.empty()) { q.release(); dq.pop_front(); }
+        }
+        if (q.size() != dq.size() || q.empty() != dq.empty() || q.bytes() > q.capacity()) {
+            std::cerr << "SIZE MISMATCH at iteration " << i << "  Expected: " << dq.size()
+                      << "  Actual: " << q.size() << "\n";
+            return false;
+        }
+        if (q.empty() && q.bytes() != 0) {
+            std::cerr << "BYTES LEFT in empty ring at iteration " << i << "\n";
+            return false;
+        }
+    }
+    if (grows == 0 || pads == 0) {
+        std::cerr << "growth or wrap padding never exercised\n";
+        return false;
+    }
+    std::cout << "  stress (init " << init_bytes << " B): " << Iterations << " ops passed ("
+              << grows << " grows, " << pads << " wraps, final capacity " << q.capacity() << " B)\n";
+    return true;
+}
+
+/*======================================================================
+ *  Edge cases
+ *====================================================================*/
+
+bool test_edges()
+{
+    ByteRingQueue q(64);
+    // Empty records have a header and a position like any other.
+    q.push(nullptr, 0);
+    q.push("abc", 3);
+    if (q.size() != 2 || q.bytes() != 16 || q.peek().size() != 0) return false;
+    q.release();
+    if (q.peek().size() != 3 || q.peek()[2] != 'c') return false;
+    q.release();
+
+    // A record larger than the buffer grows it even when empty.
+    std::vector<std::uint8_t> big(1000, 7);
+    q.push(big.data(), big.size());
+    if (q.capacity() < 1024 || !std::equal(big.begin(), big.end(), q.peek().begin())) return false;
+    q.release();
+
+    // SPSC: a max_record() record fits an empty ring wherever the head is.
+    SpscByteRingQueue s(256);
+    std::vector<std::uint8_t> rec(s.max_record(), 3);
+    for (std::size_t skew = 0; skew < 40; ++skew) {
+        if (!s.try_push(rec.data(), skew)) return false;
+        s.peek();
+        s.release();
+        if (!s.try_push(rec.data(), rec.size())) return false;
+        if (s.try_push(rec.data(), rec.size())) return false;      // full
+        if (s.peek().size() != rec.size()) return false;
+        s.release();
+        if (s.peek().data()) return false;                         // empty again
+    }
+    std::cout << "  edge cases: passed\n";
+    return true;
+}
+
+/*======================================================================
+ *  Two threads: SpscByteRingQueue delivers every record intact, in order
+ *====================================================================*/
+
+void stress_two_threads(std::uint64_t n, std::size_t cap)
+{
+    SpscByteRingQueue q(cap);
+    const std::size_t max_len = std::min<std::size_t>(q.max_record() - 16, 300);
+    auto len_of = [&](std::uint64_t i) { return std::size_t(i * 2654435761u % (max_len + 1)); };
+    std::atomic<bool> ok{true};
+
+    std::thread consumer([&] {
+        for (std::uint64_t i = 0; i < n; ++i) {
+            RingSpan<const std::uint8_t> rec;
+            while (!(rec = q.peek()).data()) std::this_thread::yield();
+            if (!matches(rec, len_of(i), i)) ok = false;
+            q.release();
+        }
+    });
+    for (std::uint64_t i = 0; i < n; ++i) {
+        const std::size_t len = len_of(i);
+        std::uint8_t* p;
+        while (!(p = q.try_reserve(len + 16))) std::this_thread::yield();   // commit less
+        fill(p, len, i);
+        q.commit(len);
+    }
+    consumer.join();
+
+    assert(ok && "a record was lost, corrupted or reordered");
+    assert(!q.peek().data() && "records left behind");
+    std::cout << "  two threads, cap " << q.capacity() << " B: " << n << " records passed\n";
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== ByteRingQueue Test (seed " << seed << ") ===\n\n";
+
+    if (!stress_test(seed, 64) || !stress_test(seed, 1024) || !test_edges()) {
+        std::cerr << "\nByteRingQueue test FAILED (seed " << seed << ")\n";
+        return 1;
+    }
+    stress_two_threads(300'000, 1024);
+    stress_two_threads(300'000, 65536);
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
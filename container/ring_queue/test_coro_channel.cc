@@ -0,0 +1,260 @@
+// container/ring_queue/test_coro_channel.cc
+// Correctness test for CoroChannel / MtCoroChannel: try_push / try_pop
+// golden model, producer / consumer coroutines on tiny capacities (so both
+// sides suspend), batched resumption, close() releasing waiters, and the
+// same workload on a multi-threaded scheduler.
+
+#include "coro_channel.hh"
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <random>
+#include <string>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+/*======================================================================
+ *  Non-suspending API vs std::deque
+ *====================================================================*/
+
+void stress_try_ops(std::mt19937::result_type seed)
+{
+    CoroScheduler sched;
+    CoroChannel<std::string> ch(sched, 8);
+    std::deque<std::string> dq;
+    std::mt19937 rng(seed);
+
+    for (long i = 0; i < 100'000; ++i) {
+        if (rng() % 3 < 2) {
+            const bool ok = ch.try_push(std::to_string(i));
+            assert(ok == (dq.size() < ch.capacity()) && "try_push full mismatch");
+            if (ok) dq.push_back(std::to_string(i));
+        } else {
+            const std::optional<std::string> v = ch.try_pop();
+            assert(v.has_value() == !dq.empty() && "try_pop empty mismatch");
+            if (v) {
+                assert(*v == dq.front() && "try_pop value mismatch");
+                dq.pop_front();
+            }
+        }
+        assert(ch.size() == dq.size() && "size mismatch");
+    }
+    const std::size_t resumed = sched.run();
+    assert(resumed == 0 && "nothing was suspended");
+    (void)resumed;
+    std::cout << "  try_push / try_pop: passed\n";
+}
+
+/*======================================================================
+ *  P producer × C consumer coroutines on one CoroScheduler
+ *
+ *  The last producer closes the channel; consumers pop until nullopt.
+ *  Per-producer order and the checksum must hold.
+ *====================================================================*/
+
+struct Tally {
+    std::uint64_t sum = 0, popped = 0;
+    bool order_ok = true;
+};
+
+template<class Channel>
+CoroTask produce(Channel& ch, unsigned p, std::uint64_t n, std::atomic<unsigned>& running)
+{
+    for (std::uint64_t s = 0; s < n; ++s) {
+        const bool ok = co_await ch.push((std::uint64_t(p) << 32) | s);
+        assert(ok && "push on an open channel failed");
+    }
+    if (running.fetch_sub(1) == 1) ch.close();
+}
+
+template<class Channel>
+CoroTask consume(Channel& ch, unsigned producers, Tally& out, std::mutex& m)
+{
+    std::vector<std::int64_t> last(producers, -1);
+    Tally t;
+    while (std::optional<std::uint64_t> v = co_await ch.pop()) {
+        const auto p = *v >> 32;
+        const auto s = std::int64_t(*v & 0xffffffffu);
+        if (s <= last[p]) t.order_ok = false;
+        last[p] = s;
+        t.sum += *v;
+        ++t.popped;
+    }
+    std::lock_guard<std::mutex> lk(m);
+    out.sum += t.sum;
+    out.popped += t.popped;
+    out.order_ok = out.order_ok && t.order_ok;
+}
+
+void check_tally(const Tally& t, unsigned producers, std::uint64_t per_producer)
+{
+    std::uint64_t expect = 0;
+    for (unsigned p = 0; p < producers; ++p)
+        expect += (std::uint64_t(p) << 32) * per_producer + per_producer * (per_producer - 1) / 2;
+    assert(t.order_ok && "per-producer order violated");
+    assert(t.popped == per_producer * producers && "elements lost at close()");
+    assert(t.sum == expect && "checksum mismatch");
+    (void)expect;
+}
+
+void stress_single_thread(unsigned producers, unsigned consumers,
+                          std::uint64_t per_producer, std::size_t cap)
+{
+    CoroScheduler sched;
+    CoroChannel<std::uint64_t> ch(sched, cap);
+    std::atomic<unsigned> running{producers};
+    std::mutex m;
+    Tally t;
+    for (unsigned c = 0; c < consumers; ++c) sched.spawn(consume(ch, producers, t, m));
+    for (unsigned p = 0; p < producers; ++p) sched.spawn(produce(ch, p, per_producer, running));
+    const std::size_t resumed = sched.run();
+
+    check_tally(t, producers, per_producer);
+    assert(ch.size() == 0 && ch.closed() && "channel not drained");
+    std::cout << "  " << producers << "P x " << consumers << "C, cap " << ch.capacity()
+              << ": passed (" << resumed << " resumptions)\n";
+}
+
+void stress_threads(unsigned threads, unsigned producers, unsigned consumers,
+                    std::uint64_t per_producer, std::size_t cap)
+{
+    MtCoroScheduler sched;
+    MtCoroChannel<std::uint64_t> ch(sched, cap);
+    std::atomic<unsigned> running{producers};
+    std::mutex m;
+    Tally t;
+    for (unsigned c = 0; c < consumers; ++c) sched.spawn(consume(ch, producers, t, m));
+    for (unsigned p = 0; p < producers; ++p) sched.spawn(produce(ch, p, per_producer, running));
+    sched.run(threads);
+
+    check_tally(t, producers, per_producer);
+    assert(ch.size() == 0 && ch.closed() && "channel not drained");
+    std::cout << "  " << threads << " threads, " << producers << "P x " << consumers
+              << "C, cap " << ch.capacity() << ": passed\n";
+}
+
+/*======================================================================
+ *  Batched resumption: one producer, one consumer, capacity C. Each
+ *  switch must move a full buffer, not a single element.
+ *====================================================================*/
+
+void test_batching()
+{
+    constexpr std::uint64_t kN = 64'000;
+    CoroScheduler sched;
+    CoroChannel<std::uint64_t> ch(sched, 64);
+    std::atomic<unsigned> running{1};
+    std::mutex m;
+    Tally t;
+    sched.spawn(consume(ch, 1, t, m));
+    sched.spawn(produce(ch, 0, kN, running));
+    const std::size_t resumed = sched.run();
+
+    check_tally(t, 1, kN);
+    assert(resumed <= 2 * (kN / 64) + 4 && "waiters resumed per element, not per batch");
+    (void)resumed;
+    std::cout << "  batching: passed (" << resumed << " resumptions for " << kN << ")\n";
+}
+
+/*======================================================================
+ *  close() resumes waiters on both sides
+ *====================================================================*/
+
+CoroTask pop_once(CoroChannel<int>& ch, std::optional<int>& out)
+{
+    out = co_await ch.pop();
+}
+
+CoroTask push_once(CoroChannel<int>& ch, int v, int& result)
+{
+    result = co_await ch.push(v);
+}
+
+void test_close()
+{
+    {   // consumers suspended on an empty channel
+        CoroScheduler sched;
+        CoroChannel<int> ch(sched, 4);
+        std::optional<int> got[3] = { 7, 7, 7 };
+        for (auto& g : got) sched.spawn(pop_once(ch, g));
+        sched.run();
+        assert(got[0] == 7 && "pop() on an empty channel did not suspend");
+        ch.close();
+        sched.run();
+        for (const auto& g : got) assert(!g && "pop() on a closed, empty channel succeeded");
+    }
+    {   // a producer suspended on a full channel
+        CoroScheduler sched;
+        CoroChannel<int> ch(sched, 2);
+        while (ch.try_push(0)) {}
+        int result = -1;
+        sched.spawn(push_once(ch, 1, result));
+        sched.run();
+        assert(result == -1 && "push() on a full channel did not suspend");
+        ch.close();
+        sched.run();
+        assert(result == 0 && "push() on a closed channel succeeded");
+
+        std::size_t n = 0;                       // buffered elements survive close()
+        while (ch.try_pop()) ++n;
+        assert(n == ch.capacity() && "close() dropped buffered elements");
+        const bool pushed = ch.try_push(2);
+        assert(!pushed && "try_push() on a closed channel succeeded");
+        (void)pushed;
+    }
+    {   // try_push hands off directly to a suspended consumer
+        CoroScheduler sched;
+        CoroChannel<int> ch(sched, 4);
+        std::optional<int> got;
+        sched.spawn(pop_once(ch, got));
+        sched.run();
+        ch.try_push(42);
+        assert(ch.size() == 0 && "value buffered instead of handed off");
+        sched.run();
+        assert(got == 42 && "handed-off value lost");
+    }
+    {   // a refused move-only value stays with the caller
+        CoroScheduler sched;
+        CoroChannel<std::unique_ptr<int>> ch(sched, 1);
+        auto first = std::make_unique<int>(1), second = std::make_unique<int>(2);
+        bool pushed = ch.try_push(std::move(first));
+        assert(pushed && !first && "accepted value not taken");
+        pushed = ch.try_push(std::move(second));
+        assert(!pushed && second && *second == 2 && "refused value lost (full)");
+        ch.close();
+        ch.try_pop();
+        pushed = ch.try_push(std::move(second));
+        assert(!pushed && second && *second == 2 && "refused value lost (closed)");
+        (void)pushed;
+    }
+    std::cout << "  close / hand-off: passed\n";
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== CoroChannel Test (seed " << seed << ") ===\n\n";
+
+    stress_try_ops(seed);
+    stress_single_thread(1, 1, 200'000, 64);
+    stress_single_thread(4, 1, 50'000, 2);
+    stress_single_thread(1, 4, 200'000, 1);
+    stress_single_thread(8, 8, 10'000, 3);
+    test_batching();
+    stress_threads(1, 2, 2, 50'000, 4);
+    stress_threads(4, 1, 1, 200'000, 64);
+    stress_threads(4, 4, 4, 50'000, 2);
+    stress_threads(8, 8, 8, 10'000, 1);
+    test_close();
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,169 @@
+// container/ring_queue/test_history.cc
+// Correctness test for HistoryQueue: overwrite-oldest semantics against a
+// capped std::deque, plus dump() output and element lifetime.
+
+#include "history_queue.hh"
+#include <deque>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+
+/*======================================================================
+ *  Golden-model checker
+ *====================================================================*/
+
+template<class T>
+bool check(const HistoryQueue<T>& q, const std::deque<T>& golden, std::size_t iteration)
+{
+    if (q.size() != golden.size() || q.empty() != golden.empty()
+        || q.full() != (golden.size() == q.capacity())) {
+        std::cerr << "SIZE MISMATCH at iteration " << iteration
+                  << "  Expected: " << golden.size() << "  Actual: " << q.size() << "\n";
+        return false;
+    }
+    if (!golden.empty() && (q.front() != golden.front() || q.back() != golden.back())) {
+        std::cerr << "FRONT/BACK MISMATCH at iteration " << iteration << "\n";
+        return false;
+    }
+    const auto [a, b] = q.segments();
+    if (!std::equal(q.begin(), q.end(), golden.begin(), golden.end())
+        || a.size() + b.size() != golden.size()
+        || !std::equal(a.begin(), a.end(), golden.begin())
+        || !std::equal(b.begin(), b.end(), golden.begin() + a.size())) {
+        std::cerr << "CONTENTS MISMATCH at iteration " << iteration << "\n";
+        return false;
+    }
+    for (std::size_t k = 0; k < golden.size(); ++k)
+        if (q[k] != golden[k]) return false;
+    return true;
+}
+
+/*======================================================================
+ *  Random push / emplace / clear / dump vs a capped std::deque
+ *====================================================================*/
+
+template<std::size_t Iterations = 200'000>
+bool stress_test(std::size_t cap, std::mt19937::result_type seed)
+{
+    HistoryQueue<long> q(cap);
+    std::deque<long> dq;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> op_dist(0, 99);
+    std::uniform_int_distribution<long> val_dist(0, 1'000'000);
+
+    auto record = [&](long v) {
+        if (dq.size() == q.capacity()) dq.pop_front();
+        dq.push_back(v);
+    };
+
+    for (std::size_t i = 0; i < Iterations; ++i) {
+        const long val = val_dist(rng);
+        const int op = op_dist(rng);
+        if (op < 60) {
+            q.push(val);
+            record(val);
+        } else if (op < 98) {
+            const long& ref = q.emplace(val);
+            if (ref != val) return false;
+            record(val);
+        } else if (op < 99) {
+            if (rng() % 16 == 0) { q.clear(); dq.clear(); }
+        } else {
+            std::ostringstream got, expect;
+            q.dump(got, ",");
+            for (long v : dq) expect << v << ",";
+            if (got.str() != expect.str()) {
+                std::cerr << "DUMP MISMATCH at iteration " << i << "\n";
+                return false;
+            }
+        }
+        if (!check(q, dq, i)) return false;
+    }
+
+    const HistoryQueue<long> copy(q);
+    if (!check(copy, dq, Iterations)) return false;
+
+    std::cout << "  stress (cap " << q.capacity() << "): " << Iterations << " ops passed\n";
+    return true;
+}
+
+/*======================================================================
+ *  Overwrite releases the evicted value
+ *====================================================================*/
+
+bool test_overwrite_lifetime()
+{
+    auto a = std::make_shared<int>(1);
+    auto b = std::make_shared<int>(2);
+    HistoryQueue<std::shared_ptr<int>> q(4);
+    for (int i = 0; i < 4; ++i) q.push(a);
+    if (a.use_count() != 5 || !q.full()) return false;
+    for (int i = 0; i < 3; ++i) q.push(b);
+    if (a.use_count() != 2 || b.use_count() != 4) return false;
+    if (q.front() != a || q.back() != b || q.size() != 4) return false;
+
+    std::cout << "  overwrite lifetime: passed\n";
+    return true;
+}
+
+/*======================================================================
+ *  Moved-from queues: empty; copyable and assignable after a move
+ *  construction, fully usable after a move assignment
+ *====================================================================*/
+
+bool test_moved_from()
+{
+    HistoryQueue<long> a(4);
+    a.push(1);
+    HistoryQueue<long> b(std::move(a));
+    if (!a.empty() || a.size() != 0 || a.begin() != a.end()) return false;
+    if (b.size() != 1 || b.front() != 1) return false;
+    const HistoryQueue<long> copy(a);                // copy of a moved-from queue
+    if (!copy.empty() || copy.capacity() != 4) return false;
+
+    a = HistoryQueue<long>(8);                       // assigned → usable again
+    for (long i = 2; i < 12; ++i) a.emplace(i);
+    if (a.size() != 8 || a.front() != 4 || a.back() != 11) return false;
+
+    HistoryQueue<long> c(2);
+    c = std::move(b);                                // b takes c's old slots
+    if (!b.empty() || b.capacity() != 2 || c.size() != 1 || c.front() != 1) return false;
+    for (long i = 7; i < 10; ++i) b.push(i);
+    if (b.size() != 2 || b.front() != 8 || b.back() != 9) return false;
+
+    std::cout << "  moved-from: passed\n";
+    return true;
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== HistoryQueue Test (seed " << seed << ") ===\n\n";
+
+    bool ok = stress_test(1, seed)
+           && stress_test(5, seed)
+           && stress_test(64, seed)
+           && test_overwrite_lifetime()
+           && test_moved_from();
+
+    std::ostringstream os;
+    HistoryQueue<int> h(4);
+    for (int i = 0; i < 10; ++i) h.push(i);
+    h.dump(os, " ");
+    ok = ok && os.str() == "6 7 8 9 ";
+
+    if (!ok) {
+        std::cerr << "\nHistoryQueue test FAILED (seed " << seed << ")\n";
+        return 1;
+    }
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,146 @@
+// container/ring_queue/test_incremental.cc
+// Correctness test for IncrementalRingQueue: random ops against std::deque,
+// with reads checked while a growth is still migrating.
+
+#include "incremental_ring_queue.hh"
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <cassert>
+#include <type_traits>
+#include <iostream>
+
+/*======================================================================
+ *  Golden-model checker
+ *====================================================================*/
+
+template<class Q, class T>
+bool check(const Q& q, const std::deque<T>& golden, std::size_t iteration)
+{
+    if (q.size() != golden.size() || q.empty() != golden.empty()) {
+        std::cerr << "SIZE MISMATCH at iteration " << iteration
+                  << "  Expected: " << golden.size() << "  Actual: " << q.size() << "\n";
+        return false;
+    }
+    if (!golden.empty() && (q.front() != golden.front() || q.back() != golden.back())) {
+        std::cerr << "FRONT/BACK MISMATCH at iteration " << iteration << "\n";
+        return false;
+    }
+    for (std::size_t k = 0; k < golden.size(); ++k) {
+        if (q[k] != golden[k]) {
+            std::cerr << "CONTENTS MISMATCH at iteration " << iteration
+                      << " index " << k << (q.migrating() ? " (migrating)" : "") << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Numbers as-is; strings long enough to defeat the small-string buffer.
+template<class T>
+T make_value(std::size_t i)
+{
+    if constexpr (std::is_arithmetic_v<T>) return T(i);
+    else return "element-number-" + std::to_string(i);
+}
+
+/*======================================================================
+ *  Random operations vs std::deque
+ *
+ *  Pushes outnumber pops so the queue keeps growing, and the occupancy
+ *  is checked in full every few steps, often mid-migration.
+ *====================================================================*/
+
+template<class T, std::size_t Iterations = 200'000>
+bool stress_test(std::mt19937::result_type seed)
+{
+    IncrementalRingQueue<T> q(1);
+    std::deque<T> dq;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> op_dist(0, 99);
+    std::size_t migrating_checks = 0;
+
+    for (std::size_t i = 0; i < Iterations; ++i) {
+        const int op = op_dist(rng);
+        if (op < 50) {
+            q.push(make_value<T>(i));
+            dq.push_back(make_value<T>(i));
+        } else if (op < 60) {
+            if (!dq.empty()) { q.push(q.front()); dq.push_back(dq.front()); }
+        } else if (op < 98) {
+            if (!dq.empty()) { q.pop(); dq.pop_front(); }
+        } else if (op < 99) {
+            if (q.capacity() < 4096) {
+                q.reserve(q.capacity() + 1);
+                if (q.migrating()) return false;
+            }
+        } else if (rng() % 512 == 0) {
+            q.clear();
+            dq.clear();
+        }
+        if (q.size() < 1024 || i % 256 == 0) {
+            migrating_checks += q.migrating();
+            if (!check(q, dq, i)) return false;
+        }
+    }
+
+    IncrementalRingQueue<T> copy(q);
+    if (!check(copy, dq, Iterations)) return false;
+    IncrementalRingQueue<T> moved(std::move(copy));
+    if (!check(moved, dq, Iterations) || copy.capacity() != 0) return false;
+
+    std::cout << "  stress: " << Iterations << " ops passed ("
+              << migrating_checks << " checks mid-migration)\n";
+    return migrating_checks > 0;
+}
+
+/*======================================================================
+ *  Every element is destroyed exactly once across both buffers
+ *====================================================================*/
+
+bool test_lifetime()
+{
+    auto token = std::make_shared<int>(0);
+    {
+        IncrementalRingQueue<std::shared_ptr<int>> q(4);
+        for (int i = 0; i < 65; ++i) q.push(token);   // 65th push: 64 → 128
+        if (!q.migrating() || token.use_count() != 66) return false;
+        for (int i = 0; i < 10; ++i) q.pop();         // pops inside the old buffer
+        if (!q.migrating() || token.use_count() != 56) return false;
+
+        // Copying from / copy-assigning a moved-from queue (no storage).
+        IncrementalRingQueue<std::shared_ptr<int>> moved(std::move(q));
+        IncrementalRingQueue<std::shared_ptr<int>> copy(q);
+        moved = q;
+        if (!copy.empty() || !moved.empty() || token.use_count() != 1) return false;
+        copy.push(token);
+        if (copy.size() != 1 || token.use_count() != 2) return false;
+    }
+    if (token.use_count() != 1) {
+        std::cerr << "LIFETIME MISMATCH: use_count " << token.use_count() << "\n";
+        return false;
+    }
+    std::cout << "  lifetime: passed\n";
+    return true;
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== IncrementalRingQueue Test (seed " << seed << ") ===\n\n";
+
+    const bool ok = stress_test<long>(seed)
+                 && stress_test<std::string>(seed)
+                 && test_lifetime();
+    if (!ok) {
+        std::cerr << "\nIncrementalRingQueue test FAILED (seed " << seed << ")\n";
+        return 1;
+    }
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,138 @@
+// container/ring_queue/test_mirrored.cc
+// Correctness test for MirroredRingQueue: golden model, contiguity across
+// the wrap point, and the double mapping itself.
+
+#include "mirrored_ring_queue.hh"
+#include <deque>
+#include <random>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+/*======================================================================
+ *  Random operations vs std::deque; data() must be contiguous
+ *====================================================================*/
+
+template<class T, std::size_t Iterations = 100'000>
+bool stress_test(std::mt19937::result_type seed)
+{
+    MirroredRingQueue<T> q;
+    std::deque<T> dq;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> op_dist(0, 5);
+    std::uniform_int_distribution<int> len_dist(0, 700);
+
+    for (std::size_t i = 0; i < Iterations; ++i) {
+        const T val = T(rng());
+        switch (op_dist(rng)) {
+            case 0: // push
+                q.push(val);
+                dq.push_back(val);
+                break;
+            case 1: // pop
+                if (dq.empty()) break;
+                q.pop();
+                dq.pop_front();
+                break;
+            case 2: { // push_n
+                std::vector<T> src(std::size_t(len_dist(rng)), val);
+                q.push_n(src.data(), src.size());
+                dq.insert(dq.end(), src.begin(), src.end());
+                break;
+            }
+            case 3: { // pop_n
+                std::vector<T> out(std::size_t(len_dist(rng)));
+                const std::size_t n = q.pop_n(out.data(), out.size());
+                if (n != std::min(out.size(), dq.size())) return false;
+                for (std::size_t k = 0; k < n; ++k, dq.pop_front())
+                    if (out[k] != dq.front()) return false;
+                break;
+            }
+            case 4: { // prepare / commit
+                const std::size_t n = std::size_t(len_dist(rng));
+                T* w = q.prepare(n);
+                for (std::size_t k = 0; k < n; ++k) w[k] = T(val + T(k));
+                q.commit(n);
+                for (std::size_t k = 0; k < n; ++k) dq.push_back(T(val + T(k)));
+                break;
+            }
+            case 5: // consume
+                if (dq.empty()) break;
+                {
+                    const std::size_t n = std::size_t(len_dist(rng)) % (dq.size() + 1);
+                    q.consume(n);
+                    dq.erase(dq.begin(), dq.begin() + n);
+                }
+                break;
+        }
+
+        if (q.size() != dq.size()) {
+            std::cerr << "SIZE MISMATCH at iteration " << i << "\n";
+            return false;
+        }
+        const T* p = q.data();          // one flat window, wrap or not
+        for (std::size_t k = 0; k < dq.size(); ++k) {
+            if (p[k] != dq[k]) {
+                std::cerr << "CONTENTS MISMATCH at iteration " << i
+                          << ", index " << k << "\n";
+                return false;
+            }
+        }
+    }
+    std::cout << "  stress (" << sizeof(T) << "-byte T): " << Iterations
+              << " ops passed, final capacity " << q.capacity() << "\n";
+    return true;
+}
+
+/*======================================================================
+ *  The two halves are the same memory
+ *====================================================================*/
+
+bool test_mirror()
+{
+    MirroredRingQueue<std::uint32_t> q(1);
+    const std::size_t cap = q.capacity();
+    if (cap * sizeof(std::uint32_t) % std::size_t(::sysconf(_SC_PAGESIZE)) != 0)
+        return false;
+
+    // Put head three slots before the end, then push across the wrap.
+    q.prepare(cap - 3);
+    q.commit(cap - 3);
+    q.consume(cap - 3);
+    for (std::uint32_t k = 0; k < 8; ++k) q.push(k);
+
+    std::uint32_t* p = q.data();
+    for (std::uint32_t k = 0; k < 8; ++k)
+        if (p[k] != k) return false;
+    // Element 3 lives in the second mapping; slot 0 of the first mapping
+    // is the same memory, in both directions.
+    std::uint32_t* alias = p + 3 - cap;
+    if (*alias != 3) return false;
+    *alias = 99;
+    if (q[3] != 99) return false;
+
+    std::cout << "  mirror: passed (capacity " << cap << ")\n";
+    return true;
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== MirroredRingQueue Test (seed " << seed << ") ===\n\n";
+
+    bool ok = test_mirror()
+           && stress_test<std::uint8_t>(seed)
+           && stress_test<std::uint64_t>(seed);
+
+    if (!ok) {
+        std::cerr << "\nTests FAILED (seed " << seed << ")\n";
+        return 1;
+    }
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
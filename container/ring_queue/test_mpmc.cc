@@ -0,0 +1,177 @@
+// container/ring_queue/test_mpmc.cc
+// Correctness test for MpmcRingQueue: single-thread golden model + many
+// producers / consumers with per-producer ordering and checksum.
+
+#include "mpmc_ring_queue.hh"
+#include <deque>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <random>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+/*======================================================================
+ *  Single-threaded: random ops vs std::deque
+ *====================================================================*/
+
+template<class T, std::size_t Iterations = 200'000>
+void stress_single_thread(std::mt19937::result_type seed)
+{
+    MpmcRingQueue<T> q(64);
+    std::deque<T> dq;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> op_dist(0, 2);
+
+    for (std::size_t i = 0; i < Iterations; ++i) {
+        if (op_dist(rng) < 2) {
+            const bool ok = q.try_push(T(i));
+            assert(ok == (dq.size() < q.capacity()) && "try_push full mismatch");
+            if (ok) dq.emplace_back(i);
+        } else {
+            T out{};
+            const bool ok = q.try_pop(out);
+            assert(ok == !dq.empty() && "try_pop empty mismatch");
+            if (ok) {
+                assert(out == dq.front() && "try_pop value mismatch");
+                dq.pop_front();
+            }
+        }
+        assert(q.size() == dq.size() && "size mismatch");
+    }
+    std::cout << "  single-thread: " << Iterations << " ops passed\n";
+}
+
+/*======================================================================
+ *  P producers × C consumers
+ *
+ *  Each value encodes (producer << 32 | sequence). A consumer must see
+ *  every producer's sequence numbers in increasing order, and the sum
+ *  over all consumers must match what was pushed.
+ *====================================================================*/
+
+void stress_threads(unsigned producers, unsigned consumers,
+                    std::uint64_t per_producer, std::size_t cap)
+{
+    MpmcRingQueue<std::uint64_t> q(cap);
+    std::atomic<std::uint64_t> popped{0};
+    std::atomic<std::uint64_t> sum{0};
+    std::atomic<bool> order_ok{true};
+    const std::uint64_t total = per_producer * producers;
+
+    std::vector<std::thread> threads;
+    for (unsigned c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            std::vector<std::int64_t> last(producers, -1);
+            std::uint64_t local_sum = 0, v;
+            while (popped.load(std::memory_order_relaxed) < total) {
+                if (!q.try_pop(v)) { std::this_thread::yield(); continue; }
+                popped.fetch_add(1, std::memory_order_relaxed);
+                const auto p = v >> 32;
+                const auto s = std::int64_t(v & 0xffffffffu);
+                if (s <= last[p]) order_ok = false;
+                last[p] = s;
+                local_sum += v;
+            }
+            sum += local_sum;
+        });
+    }
+    for (unsigned p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (std::uint64_t s = 0; s < per_producer; ++s) {
+                while (!q.try_push((std::uint64_t(p) << 32) | s)) std::this_thread::yield();
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    std::uint64_t expect = 0;
+    for (unsigned p = 0; p < producers; ++p)
+        expect += (std::uint64_t(p) << 32) * per_producer + per_producer * (per_producer - 1) / 2;
+
+    assert(order_ok && "per-producer order violated");
+    assert(sum == expect && "checksum mismatch");
+    assert(q.empty() && "queue not drained");
+    std::cout << "  " << producers << "P x " << consumers << "C, cap " << q.capacity()
+              << ": passed\n";
+}
+
+/*======================================================================
+ *  Leftover elements are destroyed exactly once
+ *====================================================================*/
+
+void test_destruction()
+{
+    auto token = std::make_shared<int>(0);
+    {
+        MpmcRingQueue<std::shared_ptr<int>> q(4);
+        for (int i = 0; i < 4; ++i) {
+            const bool ok = q.try_push(token);
+            assert(ok);
+        }
+        const bool full = !q.try_push(token);
+        assert(full && "push into full queue succeeded");
+        std::shared_ptr<int> out;
+        q.try_pop(out);
+        out.reset();
+        assert(token.use_count() == 4);
+    }
+    assert(token.use_count() == 1 && "leaked or double-destroyed elements");
+    std::cout << "  destruction: passed\n";
+}
+
+/*======================================================================
+ *  Smallest rings: capacity 1 is rounded up to 2, and a full ring
+ *  refuses pushes lap after lap
+ *====================================================================*/
+
+void test_small_capacity()
+{
+    for (std::size_t cap : { 1, 2 }) {
+        MpmcRingQueue<std::shared_ptr<int>> q(cap);
+        assert(q.capacity() == 2 && "capacity below 2");
+        auto token = std::make_shared<int>(0);
+        for (int lap = 0; lap < 5; ++lap) {
+            for (std::size_t i = 0; i < q.capacity(); ++i) {
+                const bool ok = q.try_push(token);
+                assert(ok);
+            }
+            const bool full = !q.try_push(token);
+            assert(full && "push into full queue succeeded");
+            assert(q.size() == 2 && token.use_count() == 3);
+            std::shared_ptr<int> out;
+            for (std::size_t i = 0; i < q.capacity(); ++i) {
+                const bool ok = q.try_pop(out);
+                assert(ok);
+            }
+            out.reset();
+            const bool empty = !q.try_pop(out);
+            assert(empty && q.empty() && token.use_count() == 1);
+        }
+    }
+    std::cout << "  capacity 1 / 2: passed\n";
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== MpmcRingQueue Test (seed " << seed << ") ===\n\n";
+
+    stress_single_thread<long>(seed);
+    stress_threads(1, 1, 200'000, 64);
+    stress_threads(4, 1, 50'000, 64);
+    stress_threads(1, 4, 200'000, 64);
+    stress_threads(4, 4, 50'000, 2);
+    test_destruction();
+    test_small_capacity();
+    stress_threads(2, 2, 50'000, 1);
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
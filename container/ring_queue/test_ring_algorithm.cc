@@ -0,0 +1,156 @@
+// container/ring_queue/test_ring_algorithm.cc
+// Correctness test for ring_algo::find / rfind / count (+ _if) against a
+// per-index scan through operator[]: wrapped and unwrapped queues at every
+// depth around the vector width; packed and struct-member keys of 32 and
+// 64 bits; keys of a wider or narrower type; projections with no vector
+// path.
+
+#include "ring_algorithm.hh"
+#include "small_ring_queue.hh"
+#include "soa_ring_queue.hh"
+#include <random>
+#include <cstdint>
+#include <iostream>
+
+struct Store {                                 // LSQ entry
+    std::uint64_t addr;
+    std::uint64_t data;
+    std::uint32_t size;
+    std::int32_t  seq;
+    double        ready;
+};
+
+/*======================================================================
+ *  Reference scans
+ *====================================================================*/
+
+template<class Q, class Match>
+std::size_t ref_find(const Q& q, Match match)
+{
+    for (std::size_t i = 0; i < q.size(); ++i)
+        if (match(q[i])) return i;
+    return ring_algo::npos;
+}
+
+template<class Q, class Match>
+std::size_t ref_rfind(const Q& q, Match match)
+{
+    for (std::size_t i = q.size(); i-- > 0;)
+        if (match(q[i])) return i;
+    return ring_algo::npos;
+}
+
+template<class Q, class Match>
+std::size_t ref_count(const Q& q, Match match)
+{
+    std::size_t c = 0;
+    for (std::size_t i = 0; i < q.size(); ++i) c += match(q[i]);
+    return c;
+}
+
+/*======================================================================
+ *  One queue state, every helper, a handful of keys
+ *====================================================================*/
+
+template<class Q, class Key, class Proj>
+bool check_key(const Q& q, const Key& key, Proj proj, const char* what)
+{
+    auto match = [&](const auto& x) { return std::invoke(proj, x) == key; };
+    const bool ok = ring_algo::find(q, key, proj)  == ref_find(q, match)
+                 && ring_algo::rfind(q, key, proj) == ref_rfind(q, match)
+                 && ring_algo::count(q, key, proj) == ref_count(q, match)
+                 && ring_algo::find_if(q, match)   == ref_find(q, match)
+                 && ring_algo::rfind_if(q, match)  == ref_rfind(q, match)
+                 && ring_algo::count_if(q, match)  == ref_count(q, match);
+    if (!ok)
+        std::cerr << "MISMATCH (" << what << ") at size " << q.size() << "\n";
+    return ok;
+}
+
+bool stress_test(std::mt19937::result_type seed)
+{
+    std::mt19937_64 rng(seed);
+    std::size_t checks = 0;
+
+    for (std::size_t depth = 0; depth <= 300; depth += depth < 40 ? 1 : 13) {
+        for (std::size_t skew : { std::size_t(0), std::size_t(5), depth / 2 + 3 }) {
+            RingQueue<Store> stores(ring_queue_detail::next_power_of_two(depth + 1));
+            RingQueue<std::uint32_t> addrs32(stores.capacity());
+            RingQueue<std::int64_t> addrs64(stores.capacity());
+            SmallRingQueue<std::uint64_t, 16> small;
+            for (std::size_t i = 0; i < skew; ++i) {     // rotate the head
+                stores.push(Store{}); addrs32.push(0); addrs64.push(0); small.push(0);
+            }
+            for (std::size_t i = 0; i < skew; ++i) {
+                stores.pop(); addrs32.pop(); addrs64.pop(); small.pop();
+            }
+            for (std::size_t i = 0; i < depth; ++i) {
+                const std::uint64_t a = rng() % 23;      // plenty of duplicates
+                stores.push(Store{ a, rng(), std::uint32_t(rng() % 9), std::int32_t(rng() % 7) - 3,
+                                   double(rng() % 5) });
+                addrs32.push(std::uint32_t(a));
+                addrs64.push(std::int64_t(a) - 11);
+                small.push(a);
+            }
+
+            for (int k = 0; k < 6; ++k) {
+                const std::uint64_t key = rng() % 25;
+                const std::int32_t skey = std::int32_t(rng() % 9) - 4;
+                bool ok = check_key(stores, key, &Store::addr, "64-bit member")
+                       && check_key(stores, std::uint32_t(key % 9), &Store::size, "32-bit member")
+                       && check_key(stores, skey, &Store::seq, "signed 32-bit member")
+                       && check_key(stores, double(key % 5), &Store::ready, "double member")
+                       && check_key(stores, key, [](const Store& s) { return s.addr; }, "lambda")
+                       && check_key(addrs32, std::uint32_t(key), ring_algo::identity{}, "packed u32")
+                       && check_key(addrs32, std::uint64_t(key) | (1ull << 40), ring_algo::identity{}, "wide key")
+                       && check_key(addrs64, std::int64_t(key) - 11, ring_algo::identity{}, "packed i64")
+                       && check_key(addrs64, std::int32_t(key) - 11, ring_algo::identity{}, "narrow key")
+                       && check_key(small, key, ring_algo::identity{}, "SmallRingQueue");
+                if (!ok) return false;
+                checks += 10;
+            }
+        }
+    }
+
+    // A SoaRingQueue column is a segment pair of its own.
+    SoaRingQueue<std::uint64_t, std::uint32_t> soa;
+    for (std::size_t i = 0; i < 40; ++i) soa.push(i, std::uint32_t(i % 4));
+    for (std::size_t i = 0; i < 30; ++i) soa.pop();
+    for (std::size_t i = 0; i < 50; ++i) soa.push(i, std::uint32_t(i % 4));
+    const auto col = soa.segments<1>();
+    if (col.second.empty()
+        || ring_algo::count(col, 3u) != 3 + 12
+        || ring_algo::rfind(col, 2u) != soa.size() - 4
+        || ring_algo::find(soa.segments<0>(), std::uint64_t(45)) != 10 + 45) {
+        std::cerr << "SoaRingQueue column MISMATCH\n";
+        return false;
+    }
+
+    std::cout << "  stress: " << checks << " queue / key combinations passed\n";
+    return true;
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== ring_algo Test (seed " << seed << ", "
+#if defined(__AVX512F__)
+              << "AVX-512"
+#elif defined(__AVX2__)
+              << "AVX2"
+#else
+              << "scalar"
+#endif
+              << ") ===\n\n";
+
+    if (!stress_test(seed)) {
+        std::cerr << "\nring_algo test FAILED (seed " << seed << ")\n";
+        return 1;
+    }
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,238 @@
+// container/ring_queue/test_shm.cc
+// Correctness test for ShmRingQueue: segment create / open / unlink and
+// their errors, two mappings of one segment in one process (position
+// independence), and forked producer / consumer processes in both modes.
+
+#include "shm_ring_queue.hh"
+#include <deque>
+#include <string>
+#include <random>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+struct Msg {
+    std::uint32_t producer;
+    std::uint32_t pad;
+    std::uint64_t seq;
+    std::uint64_t check;
+};
+
+static Msg make_msg(std::uint32_t producer, std::uint64_t seq)
+{
+    return { producer, 0, seq, seq * 0x9e3779b97f4a7c15ull ^ producer };
+}
+
+static const std::string kName = "/ring_queue_test_" + std::to_string(::getpid());
+
+/*======================================================================
+ *  Segment lifecycle
+ *====================================================================*/
+
+bool test_lifecycle()
+{
+    const char* name = kName.c_str();
+    ShmRingQueue<Msg>::unlink(name);
+    {
+        auto q = ShmRingQueue<Msg>::create(name, 100);
+        if (q.capacity() != 128 || !q.empty()) return false;
+
+        bool threw = false;
+        try { ShmRingQueue<Msg>::create(name); } catch (const std::system_error&) { threw = true; }
+        if (!threw) return false;                                    // exists already
+
+        threw = false;
+        try { ShmRingQueue<std::uint64_t>::open(name); } catch (const std::system_error&) { threw = true; }
+        if (!threw) return false;                                    // wrong T
+
+        threw = false;
+        try { ShmRingQueue<Msg, ShmMode::Mpsc>::open(name); } catch (const std::system_error&) { threw = true; }
+        if (!threw) return false;                                    // wrong mode
+
+        // A second mapping lands elsewhere; the indices still agree.
+        auto view = ShmRingQueue<Msg>::open(name);
+        ShmRingQueue<Msg> moved(std::move(view));
+        for (std::uint64_t i = 0; i < 1000; ++i) {
+            if (!q.try_push(make_msg(0, i))) return false;
+            if (i % 3 == 0) continue;
+            Msg m{};
+            while (moved.try_pop(m)) {}
+        }
+        std::deque<std::uint64_t> left;
+        for (std::size_t n = q.size(); n; --n) {
+            Msg m{};
+            if (!moved.try_pop(m)) return false;
+            left.push_back(m.seq);
+        }
+        if (!left.empty() && left.back() != 999) return false;
+        if (!moved.empty()) return false;
+
+        // Fill to capacity: the next push reports full.
+        for (std::size_t i = 0; i < q.capacity(); ++i)
+            if (!q.try_push(make_msg(0, i))) return false;
+        if (q.try_push(make_msg(0, 0))) return false;
+    }
+    if (!ShmRingQueue<Msg>::unlink(name)) return false;
+
+    bool threw = false;
+    try { ShmRingQueue<Msg>::open(name); } catch (const std::system_error&) { threw = true; }
+    if (!threw) return false;                                        // gone
+    std::cout << "  lifecycle: passed\n";
+    return true;
+}
+
+/*======================================================================
+ *  A consumer that attaches after the indices have moved (restart, or a
+ *  second open() once the first view is gone) sees only live messages
+ *====================================================================*/
+
+template<ShmMode Mode>
+bool test_reattach()
+{
+    using Q = ShmRingQueue<Msg, Mode>;
+    const char* name = kName.c_str();
+    Q::unlink(name);
+    bool ok = true;
+    {
+        Q q = Q::create(name, 8);
+        for (std::uint64_t i = 0; i < 3; ++i) ok = ok && q.try_push(make_msg(0, i));
+        {
+            Q consumer = Q::open(name);
+            Msg m{};
+            while (consumer.try_pop(m)) {}
+            ok = ok && m.seq == 2;
+        }
+        Q consumer = Q::open(name);                 // head and tail are both 3
+        Msg m{};
+        ok = ok && !consumer.try_pop(m) && q.empty();
+        ok = ok && q.try_push(make_msg(0, 3)) && consumer.try_pop(m) && m.seq == 3
+                && !consumer.try_pop(m) && q.empty();
+    }
+    Q::unlink(name);
+    if (!ok) {
+        std::cerr << "reattached consumer read a stale slot\n";
+        return false;
+    }
+    std::cout << "  " << (Mode == ShmMode::Spsc ? "SPSC" : "MPSC") << ", reattached consumer: passed\n";
+    return true;
+}
+
+/*======================================================================
+ *  Smallest rings: an Mpsc ring of capacity 1 is rounded up to 2; the
+ *  Spsc protocol works with one slot
+ *====================================================================*/
+
+template<ShmMode Mode>
+bool test_small_capacity(std::size_t expect_cap)
+{
+    using Q = ShmRingQueue<Msg, Mode>;
+    const char* name = kName.c_str();
+    Q::unlink(name);
+    bool ok = true;
+    {
+        Q q = Q::create(name, 1);
+        ok = q.capacity() == expect_cap;
+        for (std::uint64_t lap = 0; ok && lap < 5; ++lap) {
+            for (std::size_t i = 0; i < q.capacity(); ++i)
+                ok = ok && q.try_push(make_msg(0, lap * 8 + i));
+            ok = ok && !q.try_push(make_msg(0, 0)) && q.size() == q.capacity();
+            for (std::size_t i = 0; i < q.capacity(); ++i) {
+                Msg m{};
+                ok = ok && q.try_pop(m) && m.seq == lap * 8 + i;
+            }
+            Msg m{};
+            ok = ok && !q.try_pop(m) && q.empty();
+        }
+    }
+    Q::unlink(name);
+    if (!ok) {
+        std::cerr << "capacity-1 ring lost or overwrote a message\n";
+        return false;
+    }
+    std::cout << "  " << (Mode == ShmMode::Spsc ? "SPSC" : "MPSC") << ", create(name, 1): cap "
+              << expect_cap << ", passed\n";
+    return true;
+}
+
+/*======================================================================
+ *  Forked producers, consumer in this process: per-producer FIFO, no
+ *  loss, no corruption
+ *====================================================================*/
+
+template<ShmMode Mode>
+bool test_processes(std::uint32_t producers, std::uint64_t per_producer, std::size_t cap)
+{
+    using Q = ShmRingQueue<Msg, Mode>;
+    const char* name = kName.c_str();
+    Q::unlink(name);
+    Q q = Q::create(name, cap);
+
+    std::vector<pid_t> children;
+    for (std::uint32_t p = 0; p < producers; ++p) {
+        const pid_t pid = ::fork();
+        if (pid == 0) {
+            // Child: map the ring by name, as an unrelated process would.
+            Q out = Q::open(name);
+            for (std::uint64_t i = 0; i < per_producer; ++i) {
+                while (!out.try_push(make_msg(p, i))) ::sched_yield();
+            }
+            ::_exit(0);
+        }
+        children.push_back(pid);
+    }
+
+    std::vector<std::uint64_t> next(producers, 0);
+    bool ok = true;
+    for (std::uint64_t got = 0; got < producers * per_producer;) {
+        Msg m{};
+        if (!q.try_pop(m)) { ::sched_yield(); continue; }
+        ok = ok && m.producer < producers && m.seq == next[m.producer]
+                && m.check == make_msg(m.producer, m.seq).check;
+        if (m.producer < producers) ++next[m.producer];
+        ++got;
+    }
+    for (pid_t pid : children) {
+        int status = 0;
+        ::waitpid(pid, &status, 0);
+        ok = ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+    Q::unlink(name);
+    if (!ok || !q.empty()) {
+        std::cerr << "lost, duplicated or reordered message\n";
+        return false;
+    }
+    std::cout << "  " << (Mode == ShmMode::Spsc ? "SPSC" : "MPSC") << ", " << producers
+              << " producer process(es), cap " << q.capacity() << ": passed\n";
+    return true;
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main()
+{
+    std::cout << "\n=== ShmRingQueue Test ===\n\n";
+
+    const bool ok = test_lifecycle()
+                 && test_reattach<ShmMode::Spsc>()
+                 && test_reattach<ShmMode::Mpsc>()
+                 && test_small_capacity<ShmMode::Spsc>(1)
+                 && test_small_capacity<ShmMode::Mpsc>(2)
+                 && test_processes<ShmMode::Mpsc>(3, 20'000, 1)
+                 && test_processes<ShmMode::Spsc>(1, 200'000, 8)
+                 && test_processes<ShmMode::Spsc>(1, 200'000, 1024)
+                 && test_processes<ShmMode::Mpsc>(1, 200'000, 8)
+                 && test_processes<ShmMode::Mpsc>(3, 100'000, 8)
+                 && test_processes<ShmMode::Mpsc>(3, 100'000, 1024);
+
+    if (!ok) {
+        std::cerr << "\nShmRingQueue test FAILED\n";
+        return 1;
+    }
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
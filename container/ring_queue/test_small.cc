@@ -0,0 +1,184 @@
+// container/ring_queue/test_small.cc
+// Correctness test for SmallRingQueue<T, N> against std::deque: spills to
+// the heap and back on shrink_to_fit(), copy / move in both modes, and
+// element lifetimes across relocation.
+
+#include "small_ring_queue.hh"
+#include <deque>
+#include <string>
+#include <random>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+#include <cassert>
+#include <iostream>
+
+/*======================================================================
+ *  Golden-model checker
+ *====================================================================*/
+
+template<class Q, class T>
+bool check(const Q& q, const std::deque<T>& golden, std::size_t iteration)
+{
+    if (q.size() != golden.size() || q.empty() != golden.empty()
+        || q.is_inline() != (q.capacity() == Q::kInline)) {
+        std::cerr << "SIZE MISMATCH at iteration " << iteration
+                  << "  Expected: " << golden.size() << "  Actual: " << q.size() << "\n";
+        return false;
+    }
+    if (!golden.empty() && (q.front() != golden.front() || q.back() != golden.back())) {
+        std::cerr << "FRONT/BACK MISMATCH at iteration " << iteration << "\n";
+        return false;
+    }
+    const auto [a, b] = q.segments();
+    if (!std::equal(q.begin(), q.end(), golden.begin(), golden.end())
+        || a.size() + b.size() != golden.size()
+        || !std::equal(a.begin(), a.end(), golden.begin())
+        || !std::equal(b.begin(), b.end(), golden.begin() + a.size())) {
+        std::cerr << "CONTENTS MISMATCH at iteration " << iteration << "\n";
+        return false;
+    }
+    for (std::size_t k = 0; k < golden.size(); ++k)
+        if (q[k] != golden[k]) return false;
+    return true;
+}
+
+template<class T>
+T make_value(std::size_t i)
+{
+    if constexpr (std::is_same_v<T, std::string>) return std::to_string(i);
+    else return T(i);
+}
+
+/*======================================================================
+ *  Random operations vs std::deque. Occupancy drifts between a handful
+ *  and a few dozen, so the queue keeps crossing the inline boundary.
+ *====================================================================*/
+
+template<class T, std::size_t N, std::size_t Iterations = 200'000>
+bool stress_test(std::mt19937::result_type seed)
+{
+    using Q = SmallRingQueue<T, N>;
+    Q q;
+    std::deque<T> dq;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> op_dist(0, 99);
+    std::size_t spills = 0, returns = 0;
+
+    for (std::size_t i = 0; i < Iterations; ++i) {
+        const T val = make_value<T>(i);
+        const bool was_inline = q.is_inline();
+        const int op = op_dist(rng);
+        if (op < 45) {
+            q.push(val);
+            dq.push_back(val);
+        } else if (op < 85) {
+            if (!dq.empty()) { q.pop(); dq.pop_front(); }
+        } else if (op < 90) {
+            if (!dq.empty()) { q.pop_back(); dq.pop_back(); }
+        } else if (op < 94) {
+            q.shrink_to_fit();
+            if (!q.is_inline() && q.size() <= N) return false;
+        } else if (op < 96) {
+            Q copy(q);                               // copy keeps the contents
+            if (!check(copy, dq, i)) return false;
+            q = std::move(copy);
+        } else if (op < 98) {
+            Q moved(std::move(q));
+            if (!q.empty() || !q.is_inline() || !check(moved, dq, i)) return false;
+            q = moved;                               // copy-assign back
+        } else if (op < 99) {
+            q.reserve(dq.size() + rng() % 64);
+        } else if (rng() % 8 == 0) {
+            q.clear();
+            dq.clear();
+        }
+        spills  += was_inline && !q.is_inline();
+        returns += !was_inline && q.is_inline();
+        if (!check(q, dq, i)) return false;
+    }
+    if (spills == 0 || returns == 0) {
+        std::cerr << "inline boundary never crossed\n";
+        return false;
+    }
+    std::cout << "  stress<N=" << N << ">: " << Iterations << " ops passed ("
+              << spills << " spills, " << returns << " returns inline)\n";
+    return true;
+}
+
+/*======================================================================
+ *  Every constructed element is destroyed exactly once
+ *====================================================================*/
+
+struct Counted {
+    static inline long live = 0;
+    long v;
+    Counted(long x) : v(x) { ++live; }
+    Counted(const Counted& o) : v(o.v) { ++live; }
+    Counted(Counted&& o) noexcept : v(o.v) { ++live; }
+    Counted& operator=(const Counted&) = default;
+    ~Counted() { --live; }
+    bool operator!=(const Counted& o) const { return v != o.v; }
+};
+
+bool test_lifetime()
+{
+    {
+        SmallRingQueue<Counted, 4> q;
+        for (long i = 0; i < 3; ++i) q.push(Counted(i));
+        q.pop();                                     // head off zero
+        for (long i = 3; i < 40; ++i) q.push(Counted(i));   // wraps, then spills
+        while (q.size() > 3) q.pop();
+        q.shrink_to_fit();                           // back inline, wrapped on the heap
+        if (!q.is_inline() || q.front().v != 37 || q.back().v != 39) return false;
+        SmallRingQueue<Counted, 4> other(q);
+        other = std::move(q);
+        if (Counted::live != 3) return false;
+    }
+    if (Counted::live != 0) {
+        std::cerr << "LEAK: " << Counted::live << " elements alive\n";
+        return false;
+    }
+    std::cout << "  lifetime: passed\n";
+    return true;
+}
+
+/*======================================================================
+ *  Capacities past the 32-bit indices are refused, not truncated
+ *====================================================================*/
+
+bool test_capacity_limit()
+{
+    SmallRingQueue<long, 4> q;
+    for (long i = 0; i < 10; ++i) q.push(i);
+    for (std::size_t n : { (std::size_t(1) << 31) + 1, std::size_t(1) << 40, ~std::size_t(0) }) {
+        bool threw = false;
+        try { q.reserve(n); } catch (const std::length_error&) { threw = true; }
+        if (!threw || q.size() != 10 || q.capacity() != 16 || q.back() != 9) return false;
+    }
+    std::cout << "  capacity limit: passed\n";
+    return true;
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== SmallRingQueue Test (seed " << seed << ") ===\n\n";
+
+    const bool ok = stress_test<std::string, 8>(seed)
+                 && stress_test<std::string, 1>(seed)
+                 && stress_test<long, 16>(seed)
+                 && test_lifetime()
+                 && test_capacity_limit();
+
+    if (!ok) {
+        std::cerr << "\nSmallRingQueue test FAILED (seed " << seed << ")\n";
+        return 1;
+    }
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
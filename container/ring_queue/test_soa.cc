@@ -0,0 +1,156 @@
+// container/ring_queue/test_soa.cc
+// Correctness test for SoaRingQueue: random push / pop / consume against a
+// std::deque of tuples, per-column segments, copy / move and growth of a
+// wrapped queue.
+
+#include "soa_ring_queue.hh"
+#include <deque>
+#include <tuple>
+#include <random>
+#include <cstdint>
+#include <algorithm>
+#include <iostream>
+
+using Soa    = SoaRingQueue<std::uint64_t, std::uint32_t, double, char>;
+using Record = Soa::value_type;
+
+/*======================================================================
+ *  Golden-model checker
+ *====================================================================*/
+
+// Field I of every record, walked through segments<I>() only.
+template<std::size_t I>
+bool check_column(const Soa& q, const std::deque<Record>& golden)
+{
+    const auto [a, b] = q.segments<I>();
+    if (a.size() + b.size() != golden.size()) return false;
+    std::size_t k = 0;
+    for (const auto& v : a) if (v != std::get<I>(golden[k++])) return false;
+    for (const auto& v : b) if (v != std::get<I>(golden[k++])) return false;
+    return true;
+}
+
+bool check(const Soa& q, const std::deque<Record>& golden, std::size_t iteration)
+{
+    if (q.size() != golden.size() || q.empty() != golden.empty()) {
+        std::cerr << "SIZE MISMATCH at iteration " << iteration
+                  << "  Expected: " << golden.size() << "  Actual: " << q.size() << "\n";
+        return false;
+    }
+    if (!golden.empty() && (Record(q.front()) != golden.front()
+                            || Record(q.back()) != golden.back())) {
+        std::cerr << "FRONT/BACK MISMATCH at iteration " << iteration << "\n";
+        return false;
+    }
+    for (std::size_t k = 0; k < golden.size(); ++k) {
+        if (Record(q[k]) != golden[k] || q.get<2>(k) != std::get<2>(golden[k])) {
+            std::cerr << "RECORD MISMATCH at iteration " << iteration << ", index " << k << "\n";
+            return false;
+        }
+    }
+    if (!check_column<0>(q, golden) || !check_column<1>(q, golden)
+        || !check_column<2>(q, golden) || !check_column<3>(q, golden)) {
+        std::cerr << "COLUMN MISMATCH at iteration " << iteration << "\n";
+        return false;
+    }
+    return true;
+}
+
+/*======================================================================
+ *  Random ops vs std::deque<tuple>
+ *====================================================================*/
+
+template<std::size_t Iterations = 100'000>
+bool stress_test(std::mt19937::result_type seed)
+{
+    Soa q(2);
+    std::deque<Record> dq;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> op_dist(0, 99);
+
+    for (std::size_t i = 0; i < Iterations; ++i) {
+        const Record rec{ rng(), std::uint32_t(i), double(i) / 3, char('a' + i % 26) };
+        const int op = op_dist(rng);
+        if (op < 45) {
+            std::apply([&](auto... f) { q.push(f...); }, rec);
+            dq.push_back(rec);
+        } else if (op < 55) {
+            q.push(rec);
+            dq.push_back(rec);
+        } else if (op < 60 && !dq.empty()) {
+            std::apply([&](auto&... f) { q.push(f...); }, q.front());   // aliases q
+            dq.push_back(dq.front());
+        } else if (op < 93 && !dq.empty()) {
+            q.pop();
+            dq.pop_front();
+        } else if (op < 98) {
+            const std::size_t n = dq.empty() ? 0 : rng() % (dq.size() + 1);
+            q.consume(n);
+            dq.erase(dq.begin(), dq.begin() + std::ptrdiff_t(n));
+        } else if (op < 99 && !dq.empty()) {
+            q.back() = rec;                                 // write through refs
+            dq.back() = rec;
+        } else if (rng() % 16 == 0) {
+            q.clear();
+            dq.clear();
+        }
+        if (!check(q, dq, i)) return false;
+    }
+
+    const Soa copy(q);
+    Soa tmp(q);
+    Soa moved(std::move(tmp));
+    Soa assigned;
+    assigned = copy;
+    if (!check(copy, dq, Iterations) || !check(moved, dq, Iterations)
+        || !check(assigned, dq, Iterations))
+        return false;
+
+    tmp.push(1, 2, 3.0, 'd');                       // moved-from queue is reusable
+    if (tmp.size() != 1 || tmp.get<1>(0) != 2 || Soa(tmp).size() != 1) return false;
+
+    std::cout << "  stress: " << Iterations << " ops passed (capacity "
+              << q.capacity() << ")\n";
+    return true;
+}
+
+/*======================================================================
+ *  Growth of a wrapped queue keeps every column in order
+ *====================================================================*/
+
+bool test_wrapped_growth()
+{
+    Soa q(8);
+    std::deque<Record> dq;
+    for (int i = 0; i < 6; ++i) { q.push(i, i, i, 'x'); q.pop(); }   // head at 6
+    for (int i = 0; i < 8; ++i) { q.push(i, i, i, 'y'); dq.emplace_back(i, i, i, 'y'); }
+    if (q.segments<0>().second.empty()) return false;                   // wrapped
+    q.push(8, 8, 8, 'z');                                               // 8 → 16
+    dq.emplace_back(8, 8, 8, 'z');
+    if (q.capacity() != 16 || !check(q, dq, 0)) return false;
+
+    q.reserve(100);
+    if (q.capacity() != 128 || !check(q, dq, 0)) return false;
+
+    std::cout << "  wrapped growth: passed\n";
+    return true;
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== SoaRingQueue Test (seed " << seed << ") ===\n\n";
+
+    const bool ok = stress_test(seed) && test_wrapped_growth();
+
+    if (!ok) {
+        std::cerr << "\nSoaRingQueue test FAILED (seed " << seed << ")\n";
+        return 1;
+    }
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,224 @@
+// container/ring_queue/test_static.cc
+// Correctness test for StaticRingQueue<T, N> against std::deque.
+
+#include "static_ring_queue.hh"
+#include <deque>
+#include <new>
+#include <memory>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+
+/*======================================================================
+ *  Golden-model checker
+ *====================================================================*/
+
+template<class Q, class T>
+bool check(const Q& q, const std::deque<T>& golden, std::size_t iteration)
+{
+    if (q.size() != golden.size() || q.empty() != golden.empty()
+        || q.full() != (golden.size() == q.capacity())) {
+        std::cerr << "SIZE MISMATCH at iteration " << iteration
+                  << "  Expected: " << golden.size() << "  Actual: " << q.size() << "\n";
+        return false;
+    }
+    if (!golden.empty() && (q.front() != golden.front() || q.back() != golden.back())) {
+        std::cerr << "FRONT/BACK MISMATCH at iteration " << iteration << "\n";
+        return false;
+    }
+    const auto [a, b] = q.segments();
+    if (!std::equal(q.begin(), q.end(), golden.begin(), golden.end())
+        || a.size() + b.size() != golden.size()
+        || !std::equal(a.begin(), a.end(), golden.begin())
+        || !std::equal(b.begin(), b.end(), golden.begin() + a.size())) {
+        std::cerr << "CONTENTS MISMATCH at iteration " << iteration << "\n";
+        return false;
+    }
+    for (std::size_t k = 0; k < golden.size(); ++k)
+        if (q[k] != golden[k]) return false;
+    return true;
+}
+
+/*======================================================================
+ *  Random operations vs std::deque
+ *====================================================================*/
+
+template<std::size_t N, std::size_t Iterations = 200'000>
+bool stress_test(std::mt19937::result_type seed)
+{
+    StaticRingQueue<long, N> q;
+    std::deque<long> dq;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> op_dist(0, 9);
+    std::uniform_int_distribution<long> val_dist(0, 1'000'000);
+
+    for (std::size_t i = 0; i < Iterations; ++i) {
+        const long val = val_dist(rng);
+        switch (op_dist(rng)) {
+            case 0: { // try_push
+                const bool ok = q.try_push(val);
+                if (ok != (dq.size() < N)) return false;
+                if (ok) dq.push_back(val);
+                break;
+            }
+            case 1: // emplace when not full
+                if (q.full()) break;
+                q.emplace(val);
+                dq.push_back(val);
+                break;
+            case 2: // pop
+                if (q.empty()) break;
+                q.pop();
+                dq.pop_front();
+                break;
+            case 3: { // push_n within remaining room
+                const std::size_t k = std::size_t(val) % (N - dq.size() + 1);
+                std::vector<long> src(k, val);
+                q.push_n(src.data(), src.data() + k);
+                dq.insert(dq.end(), src.begin(), src.end());
+                break;
+            }
+            case 4: { // pop_n
+                const std::size_t k = std::size_t(val) % (N + 1);
+                std::vector<long> out(k);
+                const std::size_t n = q.pop_n(out.data(), k);
+                if (n != std::min(k, dq.size())) return false;
+                for (std::size_t j = 0; j < n; ++j, dq.pop_front())
+                    if (out[j] != dq.front()) return false;
+                break;
+            }
+            case 5: { // copy, then move back
+                StaticRingQueue<long, N> copy(q);
+                q.clear();
+                q = std::move(copy);
+                break;
+            }
+            case 6: // drain – rare
+                if (val % 32 != 0) break;
+                {
+                    std::size_t seen = 0;
+                    q.drain([&](long* run, std::size_t len) {
+                        for (std::size_t j = 0; j < len; ++j, ++seen)
+                            if (run[j] != dq[seen]) seen = ~std::size_t(0) / 2;
+                    });
+                    if (seen != dq.size()) return false;
+                    dq.clear();
+                }
+                break;
+            case 7: // push_front when not full
+                if (q.full()) break;
+                q.push_front(val);
+                dq.push_front(val);
+                break;
+            case 8: // pop_back
+                if (q.empty()) break;
+                q.pop_back();
+                dq.pop_back();
+                break;
+            case 9: { // truncate_back
+                const std::size_t k = std::size_t(val) % (dq.size() + 1);
+                q.truncate_back(k);
+                dq.resize(dq.size() - k);
+                break;
+            }
+        }
+        if (!check(q, dq, i)) return false;
+    }
+    std::cout << "  N = " << N << ": " << Iterations << " ops passed\n";
+    return true;
+}
+
+/*======================================================================
+ *  Non-trivial element lifetime
+ *====================================================================*/
+
+/** Output iterator that throws once @p budget elements have been stored. */
+struct ThrowingOutput {
+    std::vector<std::shared_ptr<int>>* dst;
+    std::size_t budget;
+
+    ThrowingOutput& operator*() { return *this; }
+    ThrowingOutput& operator++() { return *this; }
+    ThrowingOutput& operator=(std::shared_ptr<int>&& p)
+    {
+        if (dst->size() == budget) throw std::bad_alloc();
+        dst->push_back(std::move(p));
+        return *this;
+    }
+};
+
+/** Holds a token; copying throws once `budget` copies have been made. */
+struct ThrowingCopy {
+    static inline int budget = 0;
+    std::shared_ptr<int> token;
+
+    explicit ThrowingCopy(std::shared_ptr<int> t) : token(std::move(t)) {}
+    ThrowingCopy(const ThrowingCopy& o) : token(o.token)
+    {
+        if (budget-- == 0) throw std::bad_alloc();
+    }
+};
+
+bool test_destruction()
+{
+    auto token = std::make_shared<int>(0);
+    {
+        StaticRingQueue<std::shared_ptr<int>, 4> q;
+        for (int i = 0; i < 6; ++i) q.try_push(token);
+        if (token.use_count() != 5) return false;
+        q.pop();
+        StaticRingQueue<std::shared_ptr<int>, 4> copy(q);
+        if (token.use_count() != 7) return false;
+        copy.push_front(token);
+        copy.truncate_back(2);
+        copy.pop_back();
+        if (token.use_count() != 5 || copy.size() != 1) return false;
+    }
+    {
+        // pop_n into an output that throws midway, across the wrap point.
+        StaticRingQueue<std::shared_ptr<int>, 8> q;
+        for (int i = 0; i < 6; ++i) q.try_push(token);
+        for (int i = 0; i < 6; ++i) q.pop();
+        for (int i = 0; i < 6; ++i) q.try_push(token);
+        std::vector<std::shared_ptr<int>> out;
+        out.reserve(8);
+        bool threw = false;
+        try { q.pop_n(ThrowingOutput{ &out, 4 }, 6); } catch (const std::bad_alloc&) { threw = true; }
+        if (!threw || out.size() != 4 || q.size() != 2 || token.use_count() != 7) return false;
+    }
+    {
+        // A copy that throws midway releases the elements already copied.
+        StaticRingQueue<ThrowingCopy, 8> q;
+        for (int i = 0; i < 5; ++i) q.emplace(token);
+        ThrowingCopy::budget = 3;
+        bool threw = false;
+        try { StaticRingQueue<ThrowingCopy, 8> copy(q); } catch (const std::bad_alloc&) { threw = true; }
+        if (!threw || token.use_count() != 6) return false;
+    }
+    std::cout << "  destruction: passed\n";
+    return token.use_count() == 1;
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== StaticRingQueue Test (seed " << seed << ") ===\n\n";
+
+    bool ok = stress_test<1>(seed)
+           && stress_test<8>(seed)
+           && stress_test<64>(seed)
+           && test_destruction();
+
+    if (!ok) {
+        std::cerr << "\nTests FAILED (seed " << seed << ")\n";
+        return 1;
+    }
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,123 @@
+// container/ring_queue/test_time_buffer.cc
+// Correctness test for TimeBuffer: random pushes with non-decreasing
+// ready ticks and a clock that advances by random steps, against a linear
+// scan of a std::deque; wrapped buffers and equal-tick runs included.
+
+#include "time_buffer.hh"
+#include <deque>
+#include <string>
+#include <random>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <iterator>
+#include <iostream>
+
+/*======================================================================
+ *  Random push / pop_ready vs std::deque<(tick, value)>
+ *====================================================================*/
+
+template<class T, std::size_t Iterations = 200'000>
+bool stress_test(std::uint64_t max_latency, std::mt19937::result_type seed)
+{
+    TimeBuffer<T> tb(2);
+    std::deque<std::pair<std::uint64_t, T>> dq;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> op_dist(0, 99);
+    std::uniform_int_distribution<std::uint64_t> lat_dist(0, max_latency);
+    std::uint64_t now = 0, last = 0;
+    std::vector<T> got;
+
+    for (std::size_t i = 0; i < Iterations; ++i) {
+        const int op = op_dist(rng);
+        if (op < 55) {
+            // Non-decreasing ready ticks; equal ticks are common on purpose.
+            last = std::max(last, now + lat_dist(rng) / 4 * 4);
+            const T val = T(std::to_string(i));
+            tb.push(val, last);
+            dq.emplace_back(last, val);
+        } else if (op < 95) {
+            now += rng() % 8;
+            got.clear();
+            const std::size_t n = tb.pop_ready(now, std::back_inserter(got));
+            std::size_t expect = 0;
+            while (!dq.empty() && dq.front().first <= now) {
+                if (expect >= got.size() || got[expect] != dq.front().second) {
+                    std::cerr << "VALUE MISMATCH at iteration " << i << "\n";
+                    return false;
+                }
+                dq.pop_front();
+                ++expect;
+            }
+            if (n != expect || got.size() != expect) {
+                std::cerr << "READY COUNT MISMATCH at iteration " << i
+                          << "  Expected: " << expect << "  Actual: " << n << "\n";
+                return false;
+            }
+        } else if (op < 99) {
+            const std::uint64_t probe = now + rng() % (max_latency + 1);
+            std::size_t expect = 0;
+            while (expect < dq.size() && dq[expect].first <= probe) ++expect;
+            if (tb.ready(probe) != expect) {
+                std::cerr << "READY() MISMATCH at iteration " << i << "\n";
+                return false;
+            }
+        } else if (rng() % 16 == 0) {
+            tb.clear();
+            dq.clear();
+        }
+
+        if (tb.size() != dq.size()) return false;
+        if (!dq.empty() && (tb.front() != dq.front().second
+                            || tb.next_ready() != dq.front().first
+                            || tb.last_ready() != dq.back().first))
+            return false;
+    }
+    std::cout << "  stress (latency <= " << max_latency << "): " << Iterations
+              << " ops passed\n";
+    return true;
+}
+
+/*======================================================================
+ *  Hand-checked cases: wrap point, equal ticks, raw-pointer output
+ *====================================================================*/
+
+bool test_edges()
+{
+    TimeBuffer<long> tb(8);
+    for (long i = 0; i < 6; ++i) tb.push(i, 0);
+    long sink[8];
+    if (tb.pop_ready(0, sink) != 6 || sink[5] != 5) return false;     // head at 6
+
+    for (long i = 0; i < 8; ++i) tb.push(i, 10 + std::uint64_t(i / 2) * 10);   // wraps
+    if (tb.ready(9) != 0 || tb.ready(10) != 2 || tb.ready(29) != 4
+        || tb.ready(40) != 8 || tb.ready(1000) != 8)
+        return false;
+    if (tb.pop_ready(25, sink) != 4 || sink[0] != 0 || sink[3] != 3) return false;
+    if (tb.next_ready() != 30 || tb.pop_ready(40, sink) != 4 || !tb.empty()) return false;
+
+    std::cout << "  edges: passed\n";
+    return true;
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== TimeBuffer Test (seed " << seed << ") ===\n\n";
+
+    const bool ok = stress_test<std::string>(1, seed)
+                 && stress_test<std::string>(40, seed)
+                 && stress_test<std::string>(1000, seed)
+                 && test_edges();
+
+    if (!ok) {
+        std::cerr << "\nTimeBuffer test FAILED (seed " << seed << ")\n";
+        return 1;
+    }
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
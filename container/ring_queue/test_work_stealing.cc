@@ -0,0 +1,173 @@
+// container/ring_queue/test_work_stealing.cc
+// Correctness test for WorkStealingDeque and TaskPool: owner-only golden
+// model, owner push / take racing thieves from a tiny initial ring (so it
+// grows under contention), and fork-join workloads on the pool.
+
+#include "task_pool.hh"
+#include <deque>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <random>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+/*======================================================================
+ *  Owner only: push / take / steal vs std::deque
+ *====================================================================*/
+
+void stress_single_thread(std::mt19937::result_type seed)
+{
+    WorkStealingDeque<long> q(2);
+    std::deque<long> dq;
+    std::mt19937 rng(seed);
+
+    for (long i = 0; i < 200'000; ++i) {
+        const unsigned op = rng() % 8;
+        if (op < 4) {
+            q.push(i);
+            dq.push_back(i);
+        } else if (op < 6) {
+            const std::optional<long> v = q.take();
+            assert(v.has_value() == !dq.empty() && "take() empty mismatch");
+            if (v) {
+                assert(*v == dq.back() && "take() is not LIFO");
+                dq.pop_back();
+            }
+        } else {
+            const std::optional<long> v = q.steal();
+            assert(v.has_value() == !dq.empty() && "steal() empty mismatch");
+            if (v) {
+                assert(*v == dq.front() && "steal() is not FIFO");
+                dq.pop_front();
+            }
+        }
+        assert(q.size() == dq.size() && "size mismatch");
+    }
+    std::cout << "  single-thread: passed (capacity " << q.capacity() << ")\n";
+}
+
+/*======================================================================
+ *  Owner vs T thieves: every pushed value is taken or stolen exactly once
+ *====================================================================*/
+
+void stress_thieves(unsigned thieves, std::uint64_t n, std::mt19937::result_type seed)
+{
+    WorkStealingDeque<std::uint64_t> q(2);
+    std::vector<std::atomic<std::uint8_t>> seen(n);
+    std::atomic<bool> done{false};
+    std::atomic<std::uint64_t> stolen{0};
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < thieves; ++t) {
+        threads.emplace_back([&] {
+            std::uint64_t local = 0;
+            while (!done.load(std::memory_order_acquire) || !q.empty()) {
+                if (std::optional<std::uint64_t> v = q.steal()) {
+                    seen[*v].fetch_add(1, std::memory_order_relaxed);
+                    ++local;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            stolen += local;
+        });
+    }
+
+    std::mt19937 rng(seed);
+    std::uint64_t next = 0, taken = 0;
+    while (next < n) {
+        // Bursts of pushes (forcing growth) and takes, like a fork-join owner.
+        for (unsigned k = rng() % 64; k && next < n; --k) q.push(next++);
+        for (unsigned k = rng() % 48; k; --k) {
+            if (std::optional<std::uint64_t> v = q.take()) {
+                seen[*v].fetch_add(1, std::memory_order_relaxed);
+                ++taken;
+            }
+        }
+    }
+    while (std::optional<std::uint64_t> v = q.take()) {
+        seen[*v].fetch_add(1, std::memory_order_relaxed);
+        ++taken;
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& t : threads) t.join();
+
+    for (std::uint64_t i = 0; i < n; ++i)
+        assert(seen[i].load() == 1 && "element lost or duplicated");
+    assert(taken + stolen == n && "count mismatch");
+    std::cout << "  owner + " << thieves << " thieves: passed (" << stolen << " of " << n
+              << " stolen, capacity " << q.capacity() << ")\n";
+}
+
+/*======================================================================
+ *  TaskPool: recursive fork-join, a flat parallel-for and late spawns
+ *====================================================================*/
+
+std::uint64_t fib_serial(unsigned n) { return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2); }
+
+std::uint64_t fib(TaskPool& pool, unsigned n)
+{
+    if (n < 12) return fib_serial(n);
+    std::uint64_t a = 0;
+    TaskGroup g;
+    pool.spawn(g, [&] { a = fib(pool, n - 1); });
+    const std::uint64_t b = fib(pool, n - 2);
+    pool.wait(g);
+    return a + b;
+}
+
+void test_pool(unsigned threads)
+{
+    TaskPool pool(threads);
+    for (int round = 0; round < 3; ++round) {          // the pool is reusable
+        std::uint64_t r = 0;
+        pool.run([&] { r = fib(pool, 27); });
+        assert(r == 196418 && "fork-join fib mismatch");
+    }
+
+    constexpr std::size_t kN = 10'000;
+    std::vector<std::atomic<int>> hits(kN);
+    pool.run([&] {
+        TaskGroup g;
+        for (std::size_t i = 0; i < kN; ++i) pool.spawn(g, [&, i] { hits[i].fetch_add(1); });
+        pool.wait(g);
+    });
+    for (const auto& h : hits) assert(h.load() == 1 && "task lost or run twice");
+
+    // Workers park once there is nothing to steal; a task spawned later
+    // must wake one. Root never runs it, so a lost wakeup hangs here.
+    for (int round = 0; threads > 1 && round < 3; ++round) {
+        std::atomic<bool> ran{false};
+        pool.run([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            TaskGroup g;
+            pool.spawn(g, [&] { ran.store(true); });
+            while (!ran.load()) std::this_thread::yield();
+            pool.wait(g);
+        });
+    }
+    std::cout << "  pool, " << threads << " worker(s): passed\n";
+}
+
+// ---------------------------------------------------------------------
+//  Main entry point
+// ---------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    std::mt19937::result_type seed = argc >= 2 ? std::stoul(argv[1])
+                                               : std::random_device{}();
+    std::cout << "\n=== WorkStealingDeque / TaskPool Test (seed " << seed << ") ===\n\n";
+
+    stress_single_thread(seed);
+    stress_thieves(1, 500'000, seed);
+    stress_thieves(4, 500'000, seed);
+    test_pool(1);
+    test_pool(4);
+    test_pool(8);
+
+    std::cout << "\nAll tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,176 @@
+// container/ring_queue/time_buffer.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+
+/**
+ * @file   time_buffer.hh
+ * @brief  Delay-line queue: an entry pushed with `ready_at = t + L`
+ *         becomes poppable once the clock reaches that tick.
+ *
+ *  * Built on one RingQueue of (ready tick, value) entries. The entries
+ *    are sorted by tick and lie in (at most) two contiguous segments.
+ *  * `pop_ready(now, out)` pops the first few ready entries one by one
+ *    (the common cycle); past that it counts the rest with a galloping
+ *    binary search over those segments, moves their values out run by
+ *    run and retires them with a single `truncate_front`.
+ *  * Ready ticks must be pushed in non-decreasing order (true for any
+ *    fixed-latency pipe, and for variable latencies that never reorder).
+ *  * Not related to gem5's `TimeBuffer` (a wire indexed by cycle delta);
+ *    inside `namespace gem5` spell this one `::TimeBuffer`.
+ *  * C++17 (gem5 compatible).
+ */
+template<class T, class Tick = std::uint64_t>
+class TimeBuffer {
+  public:
+    using value_type = T;
+    using tick_type  = Tick;
+    using size_type  = std::size_t;
+
+    /** @brief Constructs a delay line with room for @p init_cap entries. */
+    explicit TimeBuffer(std::size_t init_cap = 16) : q_(init_cap) {}
+
+    //==========================================================================//
+    //  Core API
+    //==========================================================================//
+
+    /**
+     * @brief Schedules @p val to become ready at tick @p ready_at.
+     *
+     * @pre `empty() || ready_at >= last_ready()`.
+     */
+    template<class U>
+    void push(U&& val, Tick ready_at)
+    {
+        emplace(ready_at, std::forward<U>(val));
+    }
+
+    /** @brief Constructs an entry in place, ready at tick @p ready_at. */
+    template<class... Args>
+    T& emplace(Tick ready_at, Args&&... args)
+    {
+        assert((empty() || !(ready_at < q_.back().ready)) &&
+               "TimeBuffer ready ticks must be non-decreasing");
+        return q_.emplace(ready_at, std::forward<Args>(args)...).value;
+    }
+
+    /**
+     * @brief Moves every entry with `ready_at <= now` to @p out, oldest
+     *        first, and removes it.
+     *
+     * @return Number of entries popped.
+     */
+    template<class OutputIt>
+    std::size_t pop_ready(Tick now, OutputIt out)
+    {
+        // The common cycle has a few ready entries: pop them one by one.
+        std::size_t popped = 0;
+        for (; popped < kLinear; ++popped, ++out) {
+            if (empty() || now < q_.front().ready) return popped;
+            *out = std::move(q_.front().value);
+            q_.pop();
+        }
+        // A backlog: count the rest with the galloping search and retire
+        // them in bulk.
+        const std::size_t n = ready(now);
+        if (n == 0) return popped;
+        const auto [a, b] = q_.segments();
+        const std::size_t first_len = std::min(n, a.size());
+        for (std::size_t i = 0; i < first_len; ++i, ++out) *out = std::move(a[i].value);
+        for (std::size_t i = 0; i < n - first_len; ++i, ++out) *out = std::move(b[i].value);
+        q_.truncate_front(n);
+        return popped + n;
+    }
+
+    /** @brief Number of entries with `ready_at <= now`. */
+    [[nodiscard]] std::size_t ready(Tick now) const
+    {
+        if (empty() || now < q_.front().ready) return 0;   // the common cycle
+        const auto [a, b] = q_.segments();
+        if (!b.empty() && !(now < a[a.size() - 1].ready))
+            return a.size() + count_not_after(b, now);
+        return count_not_after(a, now);
+    }
+
+    /** @brief Oldest value. @pre `!empty()`. */
+    T& front()
+    {
+        assert(!empty() && "front() on empty TimeBuffer");
+        return q_.front().value;
+    }
+    const T& front() const
+    {
+        assert(!empty() && "front() on empty TimeBuffer");
+        return q_.front().value;
+    }
+
+    /** @brief Tick at which the oldest entry becomes ready. @pre `!empty()`. */
+    Tick next_ready() const
+    {
+        assert(!empty() && "next_ready() on empty TimeBuffer");
+        return q_.front().ready;
+    }
+
+    /** @brief Tick of the youngest entry. @pre `!empty()`. */
+    Tick last_ready() const
+    {
+        assert(!empty() && "last_ready() on empty TimeBuffer");
+        return q_.back().ready;
+    }
+
+    /** @brief Drops every entry, ready or not. */
+    void clear() noexcept { q_.clear(); }
+
+    //==========================================================================//
+    //  Queries
+    //==========================================================================//
+
+    [[nodiscard]] bool empty() const noexcept { return q_.empty(); }
+    [[nodiscard]] std::size_t size() const noexcept { return q_.size(); }
+    [[nodiscard]] std::size_t capacity() const noexcept { return q_.capacity(); }
+
+private:
+    struct Entry {
+        Tick ready;                  ///< First tick at which value is visible
+        T value;
+
+        template<class... Args>
+        explicit Entry(Tick at, Args&&... args)
+            : ready(at), value(std::forward<Args>(args)...) {}
+    };
+
+    RingQueue<Entry> q_;             ///< Sorted by ready
+
+    // ----------------------------------------------------------------- //
+    //  Entries of the sorted run @p s with tick <= now. Per-cycle polling
+    //  finds a handful ready, so the first kLinear ticks are counted with
+    //  a branch-free compare (in a sorted run, how many are <= now *is*
+    //  the split point). Past that, probe 8, 16, 32, ... and bisect only
+    //  the last interval: O(log k) for k ready entries.
+    // ----------------------------------------------------------------- //
+    static constexpr std::size_t kLinear = 8;
+
+    static std::size_t count_not_after(RingSpan<const Entry> s, Tick now)
+    {
+        const std::size_t head = std::min(s.size(), kLinear);
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < head; ++i) n += !(now < s[i].ready);
+        if (n < kLinear) return n;
+
+        std::size_t lo = kLinear - 1, step = kLinear;
+        while (lo + step < s.size() && !(now < s[lo + step].ready)) {
+            lo += step;
+            step *= 2;
+        }
+        const std::size_t hi = std::min(lo + step, s.size());
+        const auto it = std::upper_bound(s.begin() + lo, s.begin() + hi, now,
+                                         [](Tick t, const Entry& e) { return t < e.ready; });
+        return std::size_t(it - s.begin());
+    }
+};
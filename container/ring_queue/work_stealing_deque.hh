@@ -0,0 +1,185 @@
+// container/ring_queue/work_stealing_deque.hh
+#pragma once
+
+#include "ring_queue.hh"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+/**
+ * @file   work_stealing_deque.hh
+ * @brief  Chase-Lev work-stealing deque: the owner pushes and takes at the
+ *         bottom (LIFO), any other thread steals from the top (FIFO).
+ *
+ *  * Same power-of-two ring as RingQueue, indexed by ever-increasing
+ *    64-bit top / bottom counters (`& mask` on access). The owner's push
+ *    is a release store and its take one fence; only the race for the
+ *    last element costs a CAS.
+ *  * Unbounded: a full owner push grows the ring like `RingQueue::grow`,
+ *    doubling and copying the live range, then publishes the new buffer.
+ *    A thief may still be reading the old one, so it is retired, not
+ *    freed; retired buffers are released with the deque. They add up to
+ *    less than the current buffer, so the memory bound is 2x.
+ *  * Memory orders follow Lê, Pop, Cohen & Zappa Nardelli, "Correct and
+ *    Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+ *  * T must be trivially copyable (slots are `std::atomic<T>`); store task
+ *    pointers or indices.
+ *  * C++17 (gem5 compatible).
+ */
+template<class T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "WorkStealingDeque slots are std::atomic<T>: T must be trivially copyable");
+
+  public:
+    /**
+     * @brief Constructs an empty deque with room for @p init_cap elements
+     *        before the first growth.
+     */
+    explicit WorkStealingDeque(std::size_t init_cap = 1024)
+        : buffer_(new Buffer(ring_queue_detail::reserve_power_of_two(init_cap)))
+    {
+        assert(init_cap > 0 && "initial capacity must be >0");
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&)            = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    ~WorkStealingDeque() { delete buffer_.load(std::memory_order_relaxed); }
+
+    //==========================================================================//
+    //  Owner API (one thread)
+    //==========================================================================//
+
+    /** @brief Pushes @p val at the bottom, growing if full. */
+    void push(T val)
+    {
+        const std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        const std::int64_t t = top_.load(std::memory_order_acquire);
+        Buffer* buf = buffer_.load(std::memory_order_relaxed);
+        if (b - t > std::int64_t(buf->mask)) buf = grow(buf, t, b);
+        buf->put(b, val);
+        // A release store rather than the paper's release fence + relaxed
+        // store: same code on x86, and visible to ThreadSanitizer.
+        bottom_.store(b + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Takes the most recently pushed element.
+     *
+     * @return `std::nullopt` if empty (or the last element was stolen).
+     */
+    std::optional<T> take()
+    {
+        const std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* buf = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top_.load(std::memory_order_relaxed);
+
+        if (t > b) {                                        // was empty
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        const T val = buf->get(b);
+        if (t < b) return val;                              // more than one left
+
+        // Last element: race the thieves for it.
+        const bool won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                      std::memory_order_relaxed);
+        bottom_.store(b + 1, std::memory_order_relaxed);
+        if (!won) return std::nullopt;
+        return val;
+    }
+
+    //==========================================================================//
+    //  Thief API (any thread)
+    //==========================================================================//
+
+    /**
+     * @brief Steals the oldest element.
+     *
+     * @return `std::nullopt` if empty, or if another thread won the race
+     *         for that element (retrying may succeed).
+     */
+    std::optional<T> steal()
+    {
+        std::int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) return std::nullopt;
+
+        // Acquire pairs with the release in grow(): the new buffer's
+        // contents are visible.
+        const T val = buffer_.load(std::memory_order_acquire)->get(t);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed))
+            return std::nullopt;
+        return val;
+    }
+
+    //==========================================================================//
+    //  Queries (snapshots while other threads are active)
+    //==========================================================================//
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        const std::int64_t t = top_.load(std::memory_order_relaxed);
+        return b > t ? std::size_t(b - t) : 0;
+    }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /** @brief Current ring size (owner thread). */
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return buffer_.load(std::memory_order_relaxed)->mask + 1;
+    }
+
+private:
+    struct Buffer {
+        explicit Buffer(std::size_t cap)
+            : mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+
+        T get(std::int64_t i) const noexcept
+        {
+            return slots[std::size_t(i) & mask].load(std::memory_order_relaxed);
+        }
+        void put(std::int64_t i, T v) noexcept
+        {
+            slots[std::size_t(i) & mask].store(v, std::memory_order_relaxed);
+        }
+
+        const std::size_t mask;
+        const std::unique_ptr<std::atomic<T>[]> slots;
+    };
+
+    // ----------------------------------------------------------------- //
+    //  Owner only. Copies [t, b) into a ring twice the size; indices keep
+    //  their meaning, only the mask changes. Thieves that loaded the old
+    //  pointer read the same values from it, so it stays alive (retired_)
+    //  until the deque is destroyed.
+    // ----------------------------------------------------------------- //
+    Buffer* grow(Buffer* old, std::int64_t t, std::int64_t b)
+    {
+        auto fresh = std::make_unique<Buffer>(2 * (old->mask + 1));
+        for (std::int64_t i = t; i < b; ++i) fresh->put(i, old->get(i));
+        retired_.emplace_back(old);
+        buffer_.store(fresh.get(), std::memory_order_release);
+        return fresh.release();
+    }
+
+    alignas(ring_queue_detail::kCacheLine)
+    std::atomic<std::int64_t> top_{0};          ///< Next element to steal
+
+    alignas(ring_queue_detail::kCacheLine)
+    std::atomic<std::int64_t> bottom_{0};       ///< Next free slot (owner)
+    std::atomic<Buffer*> buffer_;
+    std::vector<std::unique_ptr<Buffer>> retired_;  ///< Outgrown, maybe still read
+};